@@ -11,6 +11,10 @@ filter {'options:with_rive_text'}
 do
     defines {'WITH_RIVE_TEXT'}
 end
+filter {'options:with_rive_profiling'}
+do
+    defines {'WITH_RIVE_PROFILING'}
+end
 filter {}
 
 dofile(path.join(path.getabsolute('../dependencies/'), 'premake5_harfbuzz.lua'))
@@ -164,3 +168,8 @@ newoption {
     trigger = 'with_rive_text',
     description = 'Compiles in text features.'
 }
+
+newoption {
+    trigger = 'with_rive_profiling',
+    description = 'Compiles in the profiler scopes (see rive/profiler.hpp).'
+}
@@ -484,6 +484,55 @@ class Definition {
       ctxCode.writeln('}');
     }
 
+    // Typed accessors resolved once per property key, so callers applying
+    // the same property repeatedly (keyframes) can skip the switch above.
+    for (final fieldType in getSetFieldTypes.keys) {
+      var name = fieldType.capitalizedName;
+      ctxCode.writeln('typedef void (*${name}Setter)(Core* object, '
+          '${fieldType.cppName} value);');
+      ctxCode.writeln('typedef ${fieldType.cppName} '
+          '(*${name}Getter)(Core* object);');
+    }
+    for (final fieldType in getSetFieldTypes.keys) {
+      var name = fieldType.capitalizedName;
+      ctxCode.writeln('static ${name}Setter '
+          '${fieldType.uncapitalizedName}Setter(int propertyKey){');
+      ctxCode.writeln('switch (propertyKey) {');
+      var properties = getSetFieldTypes[fieldType];
+      if (properties != null) {
+        for (final property in properties) {
+          ctxCode.writeln('case ${property.definition.name}Base'
+              '::${property.name}PropertyKey:');
+          ctxCode.writeln('return [](Core* object, '
+              '${fieldType.cppName} value) {'
+              'object->as<${property.definition.name}Base>()->'
+              '${property.name}(value);};');
+        }
+      }
+      ctxCode.writeln('}');
+      ctxCode.writeln('return nullptr;');
+      ctxCode.writeln('}');
+    }
+    for (final fieldType in getSetFieldTypes.keys) {
+      var name = fieldType.capitalizedName;
+      ctxCode.writeln('static ${name}Getter '
+          '${fieldType.uncapitalizedName}Getter(int propertyKey){');
+      ctxCode.writeln('switch (propertyKey) {');
+      var properties = getSetFieldTypes[fieldType];
+      if (properties != null) {
+        for (final property in properties) {
+          ctxCode.writeln('case ${property.definition.name}Base'
+              '::${property.name}PropertyKey:');
+          ctxCode.writeln('return [](Core* object) {'
+              'return object->as<${property.definition.name}Base>()->'
+              '${property.name}();};');
+        }
+      }
+      ctxCode.writeln('}');
+      ctxCode.writeln('return nullptr;');
+      ctxCode.writeln('}');
+    }
+
     ctxCode.writeln('static int propertyFieldId(int propertyKey) {');
     ctxCode.writeln('switch(propertyKey) {');
 
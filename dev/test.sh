@@ -9,10 +9,12 @@ pushd test &>/dev/null
 
 OPTION=$1
 UTILITY=
+CONFIG=debug
 
 if [ "$OPTION" = "help" ]; then
   echo test.sh - run the tests
   echo test.sh clean - clean and run the tests
+  echo test.sh thread - run the threaded tests with ThreadSanitizer
   exit
 elif [ "$OPTION" = "clean" ]; then
   echo Cleaning project ...
@@ -22,6 +24,12 @@ elif [ "$OPTION" = "memory" ]; then
   echo Will perform memory checks...
   UTILITY='valgrind --leak-check=full'
   shift
+elif [ "$OPTION" = "thread" ]; then
+  echo Will perform thread checks...
+  CONFIG=tsan
+  shift
+  # Just the tests running things on several threads, unless asked for others.
+  set -- "${1:-[scheduler],[executor],[assets],[parallel]}"
 elif [ "$OPTION" = "debug" ]; then
   echo Starting debugger...
   UTILITY='lldb'
@@ -29,9 +37,9 @@ elif [ "$OPTION" = "debug" ]; then
 fi
 
 $PREMAKE --scripts=../../build gmake2 || exit 1
-make -j7 || exit 1
+make config=$CONFIG -j7 || exit 1
 
-for file in ./build/bin/debug/*; do
+for file in ./build/bin/$CONFIG/*; do
   echo testing $file
   $UTILITY $file "$1"
 done
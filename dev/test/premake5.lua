@@ -14,7 +14,7 @@ newaction {
 }
 
 workspace 'rive'
-configurations {'debug'}
+configurations {'debug', 'tsan'}
 
 dofile(path.join(path.getabsolute('../../dependencies/'), 'premake5_harfbuzz.lua'))
 dofile(path.join(path.getabsolute('../../dependencies/'), 'premake5_sheenbidi.lua'))
@@ -46,14 +46,30 @@ do
         '../../utils/**.cpp' -- no_op utils
     }
 
-    defines {'TESTING', 'ENABLE_QUERY_FLAT_VERTICES', 'WITH_RIVE_TOOLS', 'WITH_RIVE_TEXT'}
+    defines {
+        'TESTING',
+        'ENABLE_QUERY_FLAT_VERTICES',
+        'WITH_RIVE_TOOLS',
+        'WITH_RIVE_TEXT',
+        'WITH_RIVE_PROFILING',
+        'CATCH_CONFIG_ENABLE_BENCHMARKING'
+    }
 
-    filter 'configurations:debug'
+    filter 'configurations:debug or tsan'
     do
         defines {'DEBUG'}
         symbols 'On'
     end
 
+    -- ThreadSanitizer build, for the tests running things on several
+    -- threads (dev/test.sh thread).
+    filter 'configurations:tsan'
+    do
+        optimize 'Debug'
+        buildoptions {'-fsanitize=thread'}
+        linkoptions {'-fsanitize=thread'}
+    end
+
     filter 'system:windows'
     do
         removebuildoptions {
@@ -68,4 +84,9 @@ do
             '_CRT_NONSTDC_NO_DEPRECATE'
         }
     end
+
+    filter 'system:linux'
+    do
+        links {'pthread'}
+    end
 end
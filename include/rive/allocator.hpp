@@ -0,0 +1,91 @@
+/*
+ * Copyright 2022 Rive
+ */
+
+#ifndef _RIVE_ALLOCATOR_HPP_
+#define _RIVE_ALLOCATOR_HPP_
+
+#include "rive/refcnt.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace rive
+{
+/// Source of memory for the objects cloned into an ArtboardInstance and for
+/// the runtime state of the scenes made from it (state instances, inputs,
+/// layers and hit shapes). The instance and each of its scenes hold a
+/// reference, so the allocator outlives everything allocated from it.
+///
+/// Allocators are not thread-safe, an ArtboardInstance and its scenes must
+/// only be used from one thread at a time.
+class Allocator : public RefCnt<Allocator>
+{
+public:
+    virtual ~Allocator() {}
+
+    /// Returns memory aligned to alignof(std::max_align_t).
+    virtual void* allocate(size_t size) = 0;
+
+    /// Returns memory from allocate, size matches what was requested.
+    virtual void deallocate(void* ptr, size_t size) = 0;
+
+    /// The allocator that Allocated objects are currently drawn from on this
+    /// thread, nullptr for the global heap.
+    static Allocator* current();
+};
+
+/// Makes an allocator current on this thread for the lifetime of the scope.
+class AllocatorScope
+{
+private:
+    Allocator* m_Previous;
+
+public:
+    AllocatorScope(Allocator* allocator);
+    ~AllocatorScope();
+
+    AllocatorScope(const AllocatorScope&) = delete;
+    AllocatorScope& operator=(const AllocatorScope&) = delete;
+};
+
+/// Bump allocator that grabs memory in large chunks and frees all of it at
+/// once when destroyed. Deallocated blocks are recycled for allocations of the
+/// same size, so state that comes and goes (like state machine states) doesn't
+/// grow the arena indefinitely. Large allocations go straight to the heap.
+class ArenaAllocator : public Allocator
+{
+public:
+    ArenaAllocator(size_t initialChunkSize = 8 * 1024);
+    ~ArenaAllocator() override;
+
+    void* allocate(size_t size) override;
+    void deallocate(void* ptr, size_t size) override;
+
+    /// Number of chunks grabbed from the heap so far.
+    size_t chunkCount() const { return m_Chunks.size(); }
+
+private:
+    std::vector<void*> m_Chunks;
+    char* m_Cursor = nullptr;
+    char* m_End = nullptr;
+    size_t m_NextChunkSize;
+    /// Singly linked lists of recycled blocks, indexed by size / kAlignment.
+    std::vector<void*> m_FreeBlocks;
+};
+
+/// Base for the scene state types that are allocated from
+/// Allocator::current() (when there is one) and remember which allocator to
+/// return their memory to, in a header in front of the object. Core objects
+/// don't carry the header, see Core::operator new.
+class Allocated
+{
+public:
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr, size_t size);
+    static void* operator new[](size_t size);
+    static void operator delete[](void* ptr, size_t size);
+};
+} // namespace rive
+
+#endif
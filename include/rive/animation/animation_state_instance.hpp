@@ -20,10 +20,11 @@ public:
     AnimationStateInstance(const AnimationState* animationState, ArtboardInstance* instance);
 
     void advance(float seconds, Span<SMIInput*>) override;
-    void apply(float mix) override;
+    void apply(float mix, PoseBuffer* pose) override;
 
     bool keepGoing() const override;
     void clearSpilledTime() override;
+    void reset() override;
 
     const LinearAnimationInstance* animationInstance() const { return &m_AnimationInstance; }
 
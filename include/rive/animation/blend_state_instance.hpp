@@ -52,6 +52,16 @@ public:
 
     bool keepGoing() const override { return m_KeepGoing; }
 
+    void reset() override
+    {
+        for (auto& animation : m_AnimationInstances)
+        {
+            animation.m_AnimationInstance.resetForReuse(1.0f);
+            animation.m_Mix = 0.0f;
+        }
+        m_KeepGoing = true;
+    }
+
     void advance(float seconds, Span<SMIInput*>) override
     {
         // NOTE: we are intentionally ignoring the animationInstances' keepGoing
@@ -67,12 +77,17 @@ public:
         }
     }
 
-    void apply(float mix) override
+    void apply(float mix, PoseBuffer* pose) override
     {
         for (auto& animation : m_AnimationInstances)
         {
             float m = mix * animation.m_Mix;
-            animation.m_AnimationInstance.apply(m);
+            // Animations that don't contribute aren't sampled at all.
+            if (m == 0.0f)
+            {
+                continue;
+            }
+            animation.m_AnimationInstance.apply(m, pose);
         }
     }
 
@@ -10,12 +10,52 @@ private:
     static constexpr float SampleStepSize = 1.0f / (SplineTableSize - 1.0f);
     float m_Values[SplineTableSize];
 
+    static constexpr int InverseTableSize = 64;
+    /// t at x = i / InverseTableSize, only valid when m_HasInverseTable.
+    float m_InverseT[InverseTableSize + 1];
+    bool m_HasInverseTable = false;
+
+    void buildInverseTable();
+
 protected:
+    /// Solves x(t) = x for t, through the inverse table when the curve has
+    /// one (solveT otherwise).
     float getT(float x) const;
+    /// Solves x(t) = x for t numerically.
+    float solveT(float x) const;
+    /// Looks t up in the inverse table, refined with one Newton step.
+    float lookupT(float x) const;
+    /// Same as getT for count (interpolator, x) pairs, the table lookups
+    /// are refined four at a time.
+    static void getT(const CubicInterpolator* const* interpolators,
+                     const float* x,
+                     float* t,
+                     size_t count);
 
 public:
+    /// Max difference in t between the inverse table lookup and solveT. When the
+    /// table is built the difference is checked (against half this bound) at
+    /// three points between every pair of samples, curves that are too steep
+    /// (x1 or x2 close to 0 or 1) fail and keep using the solver.
+    static constexpr float InverseTableMaxError = 0.0001f;
+
+    /// Opts in to building inverse tables for the interpolators resolved
+    /// from then on (those already resolved are left as they are). Off by
+    /// default, in which case getT always uses the solver.
+    static void enableInverseTables(bool value);
+    static bool inverseTablesEnabled();
+
     StatusCode onAddedDirty(CoreContext* context) override;
 
+    /// Whether getT uses the inverse table, see InverseTableMaxError and
+    /// enableInverseTables.
+    bool hasInverseTable() const { return m_HasInverseTable; }
+
+#ifdef TESTING
+    float tableT(float x) const { return lookupT(x); }
+    float solvedT(float x) const { return solveT(x); }
+#endif
+
     /// Convert a linear interpolation value to an eased one.
     virtual float transformValue(float valueFrom, float valueTo, float factor) = 0;
 
@@ -0,0 +1,70 @@
+#ifndef _RIVE_INTERPOLATION_BATCH_HPP_
+#define _RIVE_INTERPOLATION_BATCH_HPP_
+#include "rive/animation/keyframe.hpp"
+
+namespace rive
+{
+class CubicEaseInterpolator;
+class PoseBuffer;
+
+/// Double properties evaluated while applying an animation, queued so that
+/// interpolating them and mixing them with their current values happens
+/// several properties at a time. Values are only written to their objects
+/// (or accumulated into the pose) when the batch is flushed (or fills up).
+/// KeyedProperty flushes it before writing a property of another type, so
+/// those still see every double keyed before them. Double properties of
+/// several objects share a batch: their setters only dirty their own object
+/// and its dependents, which ends up the same in any order.
+class InterpolationBatch
+{
+public:
+    static const int kCapacity = 32;
+
+    InterpolationBatch(float mix, PoseBuffer* pose = nullptr) : m_Mix(mix), m_Pose(pose) {}
+    ~InterpolationBatch() { flush(); }
+
+    InterpolationBatch(const InterpolationBatch&) = delete;
+    InterpolationBatch& operator=(const InterpolationBatch&) = delete;
+
+    /// Queues object's property to be set to from + (to - from) * factor,
+    /// with factor first eased by easing when provided.
+    void add(Core* object,
+             const KeyFramePropertyAccessor& accessor,
+             float from,
+             float to,
+             float factor,
+             const CubicEaseInterpolator* easing = nullptr)
+    {
+        if (m_Count == kCapacity)
+        {
+            flush();
+        }
+        m_Objects[m_Count] = object;
+        m_Accessors[m_Count] = &accessor;
+        m_From[m_Count] = from;
+        m_To[m_Count] = to;
+        m_Factors[m_Count] = factor;
+        m_Easings[m_Count] = easing;
+        m_Count++;
+    }
+
+    /// Interpolates and writes everything queued so far.
+    void flush();
+
+    /// Where values are accumulated instead of written, if anywhere.
+    PoseBuffer* pose() const { return m_Pose; }
+
+private:
+    float m_Mix;
+    PoseBuffer* m_Pose;
+    int m_Count = 0;
+    Core* m_Objects[kCapacity];
+    const KeyFramePropertyAccessor* m_Accessors[kCapacity];
+    float m_From[kCapacity];
+    float m_To[kCapacity];
+    float m_Factors[kCapacity];
+    const CubicEaseInterpolator* m_Easings[kCapacity];
+};
+} // namespace rive
+
+#endif
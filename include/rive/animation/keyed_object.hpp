@@ -5,6 +5,8 @@
 namespace rive
 {
 class Artboard;
+struct AnimationSampleGroup;
+class InterpolationBatch;
 class KeyedProperty;
 class KeyedObject : public KeyedObjectBase
 {
@@ -18,9 +20,33 @@ public:
 
     StatusCode onAddedDirty(CoreContext* context) override;
     StatusCode onAddedClean(CoreContext* context) override;
-    void apply(Artboard* coreContext, float time, float mix);
+    size_t keyedPropertyCount() const { return m_KeyedProperties.size(); }
+
+    /// When provided, cursors holds one cached keyframe index per keyed
+    /// property and batch queues double values (see KeyedProperty::apply).
+    void apply(Artboard* coreContext,
+               float time,
+               float mix,
+               uint32_t* cursors = nullptr,
+               InterpolationBatch* batch = nullptr);
+    /// Same as above with the keyed object already resolved in the artboard.
+    void apply(Core* object,
+               float time,
+               float mix,
+               uint32_t* cursors = nullptr,
+               InterpolationBatch* batch = nullptr);
+
+    /// Applies the keyed properties to the group's samples, whose objects
+    /// (or nullptr to skip one) are in objects, see KeyedProperty::applyBatch.
+    /// cursors holds each sample's cursor for the first property, or nullptr,
+    /// and is advanced past this object's properties.
+    void applyBatch(const AnimationSampleGroup& group, Core* const* objects, uint32_t** cursors);
 
     StatusCode import(ImportStack& importStack) override;
+
+#ifdef TESTING
+    KeyedProperty* getProperty(size_t index) const { return m_KeyedProperties[index].get(); }
+#endif
 };
 } // namespace rive
 
@@ -1,15 +1,78 @@
 #ifndef _RIVE_KEYED_PROPERTY_HPP_
 #define _RIVE_KEYED_PROPERTY_HPP_
+#include "rive/animation/keyframe.hpp"
 #include "rive/generated/animation/keyed_property_base.hpp"
+#include "rive/shapes/paint/color.hpp"
 #include <vector>
 namespace rive
 {
-class KeyFrame;
+struct AnimationSampleGroup;
+class CubicEaseInterpolator;
+class InterpolationBatch;
+class PoseBuffer;
+
 class KeyedProperty : public KeyedPropertyBase
 {
 private:
+    /// Keyframes of types that aren't compacted (see onAddedClean).
     std::vector<std::unique_ptr<KeyFrame>> m_KeyFrames;
 
+    /// Time of every keyframe, searched when applying.
+    std::vector<float> m_Seconds;
+    /// Double and color keyframes are compacted into arrays once they're
+    /// resolved, at most one of these is populated, and the KeyFrame objects
+    /// are released.
+    std::vector<float> m_DoubleValues;
+    std::vector<uint32_t> m_ColorValues;
+    /// Per compacted keyframe, how to interpolate towards the next one:
+    /// kHold, kLinear or kCubic + an index into m_Interpolators.
+    std::vector<uint16_t> m_Interpolations;
+    std::vector<CubicInterpolator*> m_Interpolators;
+    enum : uint16_t
+    {
+        kHold = 0,
+        kLinear = 1,
+        kCubic = 2,
+    };
+
+    /// Accessor for propertyKey matching the type of the keyframes, resolved
+    /// in onAddedDirty. Unbound when the keyframes can't set the property, in
+    /// which case applying does nothing.
+    KeyFramePropertyAccessor m_Accessor;
+    bool m_IsBound = false;
+
+    /// Index of the first keyframe at or after seconds.
+    int closestFrameIndex(float seconds) const;
+    /// Same as above, but starts walking from the index returned last time,
+    /// which is usually the answer (or a frame or two away) during playback.
+    int closestFrameIndex(float seconds, int hint) const;
+
+    /// closestFrameIndex with the hint in cursor, which is updated, when
+    /// provided.
+    int frameIndex(float seconds, uint32_t* cursor) const;
+
+    void compact();
+    /// Compacted keyframe whose value applies as is at seconds (given the
+    /// closest frame index), or -1 when interpolating.
+    int heldFrameIndex(int idx, float seconds) const;
+    /// The value of a compacted double property at seconds, as the terms of
+    /// from + (to - from) * factor. Returns the easing still to be applied
+    /// to factor, if any.
+    const CubicEaseInterpolator* interpolationTerms(int idx,
+                                                    float seconds,
+                                                    float* from,
+                                                    float* to,
+                                                    float* factor) const;
+    void applyDouble(Core* object, int idx, float seconds, float mix, InterpolationBatch* batch);
+    /// The value of a compacted color property at seconds.
+    ColorInt colorValue(int idx, float seconds) const;
+    void applyColor(Core* object, ColorInt value, float mix, PoseBuffer* pose);
+    /// Applies a property whose keyframes aren't compacted.
+    void applyKeyFrames(Core* object, int idx, float seconds, float mix);
+    void applyDoubleBatch(const AnimationSampleGroup& group,
+                          Core* const* objects,
+                          const int* indices);
+
 public:
     KeyedProperty();
     ~KeyedProperty() override;
@@ -17,7 +80,29 @@ public:
     StatusCode onAddedClean(CoreContext* context) override;
     StatusCode onAddedDirty(CoreContext* context) override;
 
-    void apply(Core* object, float time, float mix);
+    /// When provided, cursor caches the last resolved keyframe index for the
+    /// caller (one per animation instance) to avoid searching every apply.
+    /// When provided, double values are queued in batch rather than written
+    /// right away.
+    void apply(Core* object,
+               float time,
+               float mix,
+               uint32_t* cursor = nullptr,
+               InterpolationBatch* batch = nullptr);
+
+    /// Applies the property to the group's samples, whose objects (or
+    /// nullptr to skip one) are in objects, as apply would to each of them.
+    /// The keyframe is searched for once per distinct time, starting from a
+    /// cursor at the earliest time, and the value computed once per time.
+    /// Every sample's cursor (when it has one) is updated.
+    void applyBatch(const AnimationSampleGroup& group,
+                    Core* const* objects,
+                    uint32_t* const* cursors);
+
+    /// Number of keyframes in the property.
+    size_t keyFrameCount() const { return m_Seconds.size(); }
+    /// Whether the keyframes have been compacted into arrays.
+    bool isCompacted() const { return m_KeyFrames.empty() && !m_Seconds.empty(); }
 
     StatusCode import(ImportStack& importStack) override;
 };
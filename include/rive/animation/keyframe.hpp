@@ -1,10 +1,31 @@
 #ifndef _RIVE_KEY_FRAME_HPP_
 #define _RIVE_KEY_FRAME_HPP_
 #include "rive/generated/animation/keyframe_base.hpp"
+#include <string>
 namespace rive
 {
 class CubicInterpolator;
 
+/// Typed setter (and getter, for types that can be mixed) of the property a
+/// KeyedProperty animates. Bound once when the animation is loaded, only the
+/// members matching the keyframe type are valid.
+struct KeyFramePropertyAccessor
+{
+    union
+    {
+        void (*setDouble)(Core* object, float value);
+        void (*setColor)(Core* object, int value);
+        void (*setBool)(Core* object, bool value);
+        void (*setUint)(Core* object, uint32_t value);
+        void (*setString)(Core* object, std::string value);
+    };
+    union
+    {
+        float (*getDouble)(Core* object);
+        int (*getColor)(Core* object);
+    };
+};
+
 class KeyFrame : public KeyFrameBase
 {
 private:
@@ -18,9 +39,9 @@ public:
     void computeSeconds(int fps);
 
     StatusCode onAddedDirty(CoreContext* context) override;
-    virtual void apply(Core* object, int propertyKey, float mix) = 0;
+    virtual void apply(Core* object, const KeyFramePropertyAccessor& accessor, float mix) = 0;
     virtual void applyInterpolation(Core* object,
-                                    int propertyKey,
+                                    const KeyFramePropertyAccessor& accessor,
                                     float seconds,
                                     const KeyFrame* nextFrame,
                                     float mix) = 0;
@@ -6,9 +6,9 @@ namespace rive
 class KeyFrameDouble : public KeyFrameDoubleBase
 {
 public:
-    void apply(Core* object, int propertyKey, float mix) override;
+    void apply(Core* object, const KeyFramePropertyAccessor& accessor, float mix) override;
     void applyInterpolation(Core* object,
-                            int propertyKey,
+                            const KeyFramePropertyAccessor& accessor,
                             float seconds,
                             const KeyFrame* nextFrame,
                             float mix) override;
@@ -7,9 +7,9 @@ namespace rive
 class KeyFrameId : public KeyFrameIdBase
 {
 public:
-    void apply(Core* object, int propertyKey, float mix) override;
+    void apply(Core* object, const KeyFramePropertyAccessor& accessor, float mix) override;
     void applyInterpolation(Core* object,
-                            int propertyKey,
+                            const KeyFramePropertyAccessor& accessor,
                             float seconds,
                             const KeyFrame* nextFrame,
                             float mix) override;
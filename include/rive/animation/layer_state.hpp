@@ -19,6 +19,9 @@ class LayerState : public LayerStateBase
 
 private:
     std::vector<StateTransition*> m_Transitions;
+    /// Sorted ids of the inputs the transitions' conditions read.
+    std::vector<uint32_t> m_TransitionInputs;
+    bool m_HasExitTimeTransition = false;
     void addTransition(StateTransition* transition);
 
 public:
@@ -38,6 +41,15 @@ public:
         return nullptr;
     }
 
+    /// Ids of the inputs read by the conditions of this state's
+    /// transitions.
+    const std::vector<uint32_t>& transitionInputs() const { return m_TransitionInputs; }
+
+    /// Whether any (enabled) transition out of this state waits for an exit
+    /// time. When none do, whether a transition can be taken only depends on
+    /// transitionInputs.
+    bool hasExitTimeTransition() const { return m_HasExitTimeTransition; }
+
     /// Make an instance of this state that can be advanced and applied by
     /// the state machine when it is active or being transitioned from.
     virtual std::unique_ptr<StateInstance> makeInstance(ArtboardInstance* instance) const;
@@ -2,11 +2,42 @@
 #define _RIVE_LINEAR_ANIMATION_HPP_
 #include "rive/animation/loop.hpp"
 #include "rive/generated/animation/linear_animation_base.hpp"
+#include "rive/span.hpp"
 #include <vector>
 namespace rive
 {
 class Artboard;
+class Core;
 class KeyedObject;
+class PoseBuffer;
+
+/// An artboard to apply an animation to with LinearAnimation::applyBatch,
+/// with the same meaning as LinearAnimation::apply's arguments.
+struct AnimationSample
+{
+    Artboard* artboard;
+    float time;
+    float mix;
+    uint32_t* keyFrameCursors;
+    Core* const* keyedObjects;
+    PoseBuffer* pose;
+};
+
+/// Up to kCapacity samples that LinearAnimation::applyBatch applies each
+/// keyed property to together. Samples playing at the same time share their
+/// keyframe search and interpolation, so the samples' distinct times are
+/// listed (in ascending order) along with which one each sample is at.
+struct AnimationSampleGroup
+{
+    static const int kCapacity = 64;
+
+    size_t count;
+    const float* mixes;
+    PoseBuffer* const* poses;
+    size_t timeCount;
+    const float* times;
+    const uint8_t* timeIndices;
+};
 
 class LinearAnimation : public LinearAnimationBase
 {
@@ -21,7 +52,33 @@ public:
     StatusCode onAddedDirty(CoreContext* context) override;
     StatusCode onAddedClean(CoreContext* context) override;
     void addKeyedObject(std::unique_ptr<KeyedObject>);
-    void apply(Artboard* artboard, float time, float mix = 1.0f) const;
+    /// Total number of keyed properties across all keyed objects, the size
+    /// of the keyframe cursor buffer an instance passes to apply.
+    size_t keyedPropertyCount() const;
+
+    /// Resolves the object each keyed object animates in artboard, in order,
+    /// so an instance can apply without looking them up every time.
+    void resolveKeyedObjects(const Artboard* artboard, std::vector<Core*>& objects) const;
+
+    /// When provided, keyFrameCursors (keyedPropertyCount() entries, zero
+    /// initialized) caches the keyframe each property last resolved to, so
+    /// applying while playing forward skips the keyframe search.
+    /// keyedObjects, when provided, are the objects from resolveKeyedObjects
+    /// for this artboard. When pose is provided, double and color properties
+    /// are accumulated into it instead of written to their objects.
+    void apply(Artboard* artboard,
+               float time,
+               float mix = 1.0f,
+               uint32_t* keyFrameCursors = nullptr,
+               Core* const* keyedObjects = nullptr,
+               PoseBuffer* pose = nullptr) const;
+
+    /// Applies the animation to several artboards (usually instances of the
+    /// same one, a crowd playing it at different times), as apply would to
+    /// each of them. Every keyed property is evaluated once per distinct
+    /// time and mixed into all the artboards' objects together, or
+    /// accumulated into their poses.
+    void applyBatch(Span<const AnimationSample> samples) const;
 
     Loop loop() const { return (Loop)loopValue(); }
 
@@ -42,6 +99,7 @@ public:
 
 #ifdef TESTING
     size_t numKeyedObjects() { return m_KeyedObjects.size(); }
+    KeyedObject* getObject(size_t index) const { return m_KeyedObjects[index].get(); }
     // Used in testing to check how many animations gets deleted.
     static int deleteCount;
 #endif
@@ -21,6 +21,12 @@ private:
     float m_Direction;
     bool m_DidLoop;
     int m_LoopValue = -1;
+    // Last keyframe index resolved by each keyed property of the animation.
+    // Mutable as it's purely a cache for apply.
+    mutable std::vector<uint32_t> m_KeyFrameCursors;
+    // The artboard instance's object for each keyed object of the animation,
+    // resolved once so applying doesn't look them up by id.
+    std::vector<Core*> m_KeyedObjects;
 
 public:
     LinearAnimationInstance(const LinearAnimation*, ArtboardInstance*, float speedMultiplier = 1.0);
@@ -62,8 +68,29 @@ public:
 
     // Applies the animation instance to its artboard instance. The mix (a value
     // between 0 and 1) is the strength at which the animation is mixed with
-    // other animations applied to the artboard.
-    void apply(float mix = 1.0f) const { m_Animation->apply(m_ArtboardInstance, m_Time, mix); }
+    // other animations applied to the artboard. When a pose is provided,
+    // double and color properties are accumulated into it rather than written.
+    void apply(float mix = 1.0f, PoseBuffer* pose = nullptr) const
+    {
+        m_Animation->apply(m_ArtboardInstance,
+                           m_Time,
+                           mix,
+                           m_KeyFrameCursors.data(),
+                           m_KeyedObjects.data(),
+                           pose);
+    }
+
+    // The instance at its current time, to apply along with other instances
+    // of the same animation with LinearAnimation::applyBatch.
+    AnimationSample sample(float mix = 1.0f, PoseBuffer* pose = nullptr) const
+    {
+        return {m_ArtboardInstance,
+                m_Time,
+                mix,
+                m_KeyFrameCursors.data(),
+                m_KeyedObjects.data(),
+                pose};
+    }
 
     // Set when the animation is advanced, true if the animation has stopped
     // (oneShot), reached the end (loop), or changed direction (pingPong)
@@ -94,7 +121,17 @@ public:
     bool isTranslucent() const override;
     bool advanceAndApply(float seconds) override;
     std::string name() const override;
+
     void reset(float speedMultiplier);
+
+private:
+    friend class AnimationStateInstance;
+    template <class T, class U> friend class BlendStateInstance;
+
+    // Returns the instance to the start of the animation (or its end when
+    // playing backwards) and clears its playback state, as it was when it
+    // was made. Used by the state instances reused on state re-entry.
+    void resetForReuse(float speedMultiplier);
 };
 } // namespace rive
 #endif
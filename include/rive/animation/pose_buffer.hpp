@@ -0,0 +1,68 @@
+#ifndef _RIVE_POSE_BUFFER_HPP_
+#define _RIVE_POSE_BUFFER_HPP_
+#include "rive/animation/keyframe.hpp"
+#include "rive/shapes/paint/color.hpp"
+#include <vector>
+
+namespace rive
+{
+/// Accumulates the double and color properties of several animations applied
+/// one after the other (blend states, transitions), so each property is
+/// written to its object once, when the pose is written, rather than once per
+/// animation.
+///
+/// Mixing follows the same rules as applying directly: each value is mixed
+/// into the result of the animations accumulated before it. Bool, id and
+/// string properties aren't mixed and are still set as they're applied.
+class PoseBuffer
+{
+public:
+    PoseBuffer();
+
+    /// Mixes value into the pose of object's property. The first time a
+    /// property is accumulated the mix starts from its current value.
+    void accumulate(Core* object,
+                    const KeyFramePropertyAccessor& accessor,
+                    float value,
+                    float mix);
+    /// Same as above for a color property.
+    void accumulateColor(Core* object,
+                         const KeyFramePropertyAccessor& accessor,
+                         ColorInt value,
+                         float mix);
+
+    /// Writes every accumulated property to its object and clears the pose.
+    void write();
+
+    /// Number of properties accumulated since the last write.
+    size_t size() const { return m_Entries.size(); }
+
+private:
+    struct Entry
+    {
+        Core* object;
+        const KeyFramePropertyAccessor* accessor;
+        float value;
+        ColorInt color;
+        uint32_t slot;
+        bool isColor;
+    };
+    /// Properties in the order they were first accumulated.
+    std::vector<Entry> m_Entries;
+    /// Open addressed hash of (object, setter of the property's type) to an index in m_Entries + 1,
+    /// 0 for empty slots. Always at least twice the size of m_Entries.
+    std::vector<uint32_t> m_Slots;
+
+    uint32_t findSlot(Core* object, const KeyFramePropertyAccessor& accessor, bool isColor) const;
+    void grow();
+    /// The entry for object's property, nullptr when it hasn't been
+    /// accumulated yet, in which case slot is where to add it.
+    Entry* find(Core* object,
+                const KeyFramePropertyAccessor& accessor,
+                bool isColor,
+                uint32_t* slot);
+    void add(const Entry& entry);
+};
+} // namespace rive
+
+#endif
@@ -4,6 +4,7 @@
 #include <string>
 #include <stddef.h>
 #include "rive/rive_types.hpp"
+#include "rive/allocator.hpp"
 #include "rive/span.hpp"
 
 namespace rive
@@ -11,9 +12,10 @@ namespace rive
 class LayerState;
 class SMIInput;
 class ArtboardInstance;
+class PoseBuffer;
 
 /// Represents an instance of a state tracked by the State Machine.
-class StateInstance
+class StateInstance : public Allocated
 {
 private:
     const LayerState* m_LayerState;
@@ -22,13 +24,19 @@ public:
     StateInstance(const LayerState* layerState);
     virtual ~StateInstance();
     virtual void advance(float seconds, Span<SMIInput*> inputs) = 0;
-    virtual void apply(float mix) = 0;
+    /// Applies the state with the given mix, accumulating double and color
+    /// properties into pose.
+    virtual void apply(float mix, PoseBuffer* pose) = 0;
 
     /// Returns true when the State Machine needs to keep advancing this
     /// state.
     virtual bool keepGoing() const = 0;
     virtual void clearSpilledTime() {}
 
+    /// Returns the instance to the state it was made in, called when the
+    /// State Machine re-enters the state so the instance can be reused.
+    virtual void reset() = 0;
+
     const LayerState* state() const;
 };
 } // namespace rive
@@ -1,6 +1,7 @@
 #ifndef _RIVE_STATE_MACHINE_HPP_
 #define _RIVE_STATE_MACHINE_HPP_
 #include "rive/generated/animation/state_machine_base.hpp"
+#include "rive/name_index.hpp"
 #include <stdio.h>
 #include <vector>
 
@@ -18,6 +19,8 @@ private:
     std::vector<std::unique_ptr<StateMachineLayer>> m_Layers;
     std::vector<std::unique_ptr<StateMachineInput>> m_Inputs;
     std::vector<std::unique_ptr<StateMachineListener>> m_Listeners;
+    /// Inputs by name, built the first time one is looked up.
+    mutable NameIndex m_InputNames;
 
     void addLayer(std::unique_ptr<StateMachineLayer>);
     void addInput(std::unique_ptr<StateMachineInput>);
@@ -33,12 +36,26 @@ public:
     size_t inputCount() const { return m_Inputs.size(); }
     size_t listenerCount() const { return m_Listeners.size(); }
 
-    const StateMachineInput* input(std::string name) const;
+    const StateMachineInput* input(StringView name) const;
+    const StateMachineInput* input(std::string name) const { return input(StringView(name)); }
+    template <typename C> const StateMachineInput* input(const C* name) const
+    {
+        return input(StringView(name));
+    }
     const StateMachineInput* input(size_t index) const;
-    const StateMachineLayer* layer(std::string name) const;
+    const StateMachineLayer* layer(StringView name) const;
+    const StateMachineLayer* layer(std::string name) const { return layer(StringView(name)); }
+    template <typename C> const StateMachineLayer* layer(const C* name) const
+    {
+        return layer(StringView(name));
+    }
     const StateMachineLayer* layer(size_t index) const;
     const StateMachineListener* listener(size_t index) const;
 
+    /// Hashes the names of the inputs, shared by the instances of this state
+    /// machine (whose inputs line up with these).
+    const NameIndex& inputNames() const;
+
     StatusCode onAddedDirty(CoreContext* context) override;
     StatusCode onAddedClean(CoreContext* context) override;
 };
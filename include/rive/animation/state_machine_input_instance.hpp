@@ -3,6 +3,7 @@
 
 #include <string>
 #include <stdint.h>
+#include "rive/allocator.hpp"
 
 namespace rive
 {
@@ -14,7 +15,7 @@ class StateMachineTrigger;
 class TransitionTriggerCondition;
 class StateMachineLayerInstance;
 
-class SMIInput
+class SMIInput : public Allocated
 {
     friend class StateMachineInstance;
     friend class StateMachineLayerInstance;
@@ -22,11 +23,15 @@ class SMIInput
 private:
     StateMachineInstance* m_MachineInstance;
     const StateMachineInput* m_Input;
+    /// The machine's input change count when this input last changed.
+    uint32_t m_ChangedAt = 0;
 
     virtual void advanced() {}
 
 protected:
     void valueChanged();
+    /// Records that the value changed without requesting an advance.
+    void stampChanged();
 
     SMIInput(const StateMachineInput* input, StateMachineInstance* machineInstance);
 
@@ -70,12 +75,13 @@ class SMITrigger : public SMIInput
 {
     friend class StateMachineInstance;
     friend class TransitionTriggerCondition;
+    friend struct CompiledTransitionCondition;
 
 private:
     bool m_Fired = false;
 
     SMITrigger(const StateMachineTrigger* input, StateMachineInstance* machineInstance);
-    void advanced() override { m_Fired = false; }
+    void advanced() override;
 
 public:
     void fire();
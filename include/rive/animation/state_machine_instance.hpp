@@ -5,6 +5,7 @@
 #include <stddef.h>
 #include <vector>
 #include "rive/animation/linear_animation_instance.hpp"
+#include "rive/animation/pose_buffer.hpp"
 #include "rive/listener_type.hpp"
 #include "rive/scene.hpp"
 
@@ -20,6 +21,7 @@ class SMITrigger;
 class Shape;
 class StateMachineLayerInstance;
 class HitShape;
+class HitShapeGrid;
 class NestedArtboard;
 
 class StateMachineInstance : public Scene
@@ -29,14 +31,25 @@ class StateMachineInstance : public Scene
 private:
     const StateMachine* m_Machine;
     bool m_NeedsAdvance = false;
+    /// Incremented each time an input changes, lets layers tell whether the
+    /// inputs their transitions read changed since they last evaluated them.
+    uint32_t m_InputChanges = 0;
 
     std::vector<SMIInput*> m_InputInstances; // we own each pointer
     size_t m_LayerCount;
     StateMachineLayerInstance* m_Layers;
+    /// Layers accumulate the animations they mix into this pose.
+    PoseBuffer m_Pose;
 
     void markNeedsAdvance();
 
     std::vector<std::unique_ptr<HitShape>> m_HitShapes;
+    /// Buckets m_HitShapes by their bounds, rebuilt when they change.
+    std::unique_ptr<HitShapeGrid> m_HitShapeGrid;
+    /// Indices of the hovered hit shapes, and scratch for the ones visited
+    /// by a pointer event, both ascending.
+    std::vector<uint32_t> m_HoveredShapes;
+    std::vector<uint32_t> m_VisitedShapes;
     std::vector<NestedArtboard*> m_HitNestedArtboards;
 
     /// Provide a hitListener if you want to process a down or an up for the pointer position
@@ -44,7 +57,7 @@ private:
     void updateListeners(Vec2D position, ListenerType hitListener);
 
     template <typename SMType, typename InstType>
-    InstType* getNamedInput(const std::string& name) const;
+    InstType* getNamedInput(StringView name) const;
 
 public:
     StateMachineInstance(const StateMachine* machine, ArtboardInstance* instance);
@@ -63,9 +76,12 @@ public:
 
     size_t inputCount() const override { return m_InputInstances.size(); }
     SMIInput* input(size_t index) const override;
-    SMIBool* getBool(const std::string& name) const override;
-    SMINumber* getNumber(const std::string& name) const override;
-    SMITrigger* getTrigger(const std::string& name) const override;
+    using Scene::getBool;
+    using Scene::getNumber;
+    using Scene::getTrigger;
+    SMIBool* getBool(StringView name) const override;
+    SMINumber* getNumber(StringView name) const override;
+    SMITrigger* getTrigger(StringView name) const override;
 
     size_t currentAnimationCount() const;
     const LinearAnimationInstance* currentAnimationByIndex(size_t index) const;
@@ -74,6 +90,10 @@ public:
     // previous advance.
     size_t stateChangedCount() const;
 
+    // The number of transition conditions evaluated across all layers since
+    // the instance was made.
+    size_t evaluatedConditionCount() const;
+
     // Returns the state name for states that changed in layers on the
     // previously called advance. If the index of out of range, it returns
     // the empty string.
@@ -1,6 +1,7 @@
 #ifndef _RIVE_STATE_MACHINE_LAYER_HPP_
 #define _RIVE_STATE_MACHINE_LAYER_HPP_
 #include "rive/generated/animation/state_machine_layer_base.hpp"
+#include "rive/animation/transition_condition.hpp"
 #include <stdio.h>
 #include <vector>
 
@@ -20,6 +21,9 @@ private:
     AnyState* m_Any = nullptr;
     EntryState* m_Entry = nullptr;
     ExitState* m_Exit = nullptr;
+    /// The conditions of every transition in the layer, each transition's
+    /// conditions contiguous.
+    std::vector<CompiledTransitionCondition> m_Conditions;
 
     void addState(LayerState* state);
 
@@ -34,7 +38,6 @@ public:
     const EntryState* entryState() const { return m_Entry; }
     const ExitState* exitState() const { return m_Exit; }
 
-#ifdef TESTING
     size_t stateCount() const { return m_States.size(); }
     LayerState* state(size_t index) const
     {
@@ -44,7 +47,6 @@ public:
         }
         return nullptr;
     }
-#endif
 };
 } // namespace rive
 
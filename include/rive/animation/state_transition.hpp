@@ -12,6 +12,8 @@ class LayerState;
 class StateMachineLayerImporter;
 class StateTransitionImporter;
 class TransitionCondition;
+struct CompiledTransitionCondition;
+class StateMachineLayer;
 class StateInstance;
 class SMIInput;
 class LinearAnimation;
@@ -28,6 +30,7 @@ class StateTransition : public StateTransitionBase
 {
     friend class StateMachineLayerImporter;
     friend class StateTransitionImporter;
+    friend class StateMachineLayer;
 
 private:
     StateTransitionFlags transitionFlags() const
@@ -38,6 +41,9 @@ private:
     CubicInterpolator* m_Interpolator = nullptr;
 
     std::vector<TransitionCondition*> m_Conditions;
+    /// m_Conditions in the layer's condition table, set once the layer is
+    /// clean.
+    const CompiledTransitionCondition* m_CompiledConditions = nullptr;
     void addCondition(TransitionCondition* condition);
 
 public:
@@ -57,10 +63,12 @@ public:
     }
 
     /// Returns AllowTransition::yes when this transition can be taken from
-    /// stateFrom with the given inputs.
+    /// stateFrom with the given inputs. When provided, evaluatedConditions
+    /// is incremented by the number of conditions that were evaluated.
     AllowTransition allowed(StateInstance* stateFrom,
                             Span<SMIInput*> inputs,
-                            bool ignoreTriggers) const;
+                            bool ignoreTriggers,
+                            size_t* evaluatedConditions = nullptr) const;
 
     /// Whether the animation is held at exit or if it keeps advancing
     /// during mixing.
@@ -15,9 +15,10 @@ public:
     SystemStateInstance(const LayerState* layerState, ArtboardInstance* instance);
 
     void advance(float seconds, Span<SMIInput*> inputs) override;
-    void apply(float mix) override;
+    void apply(float mix, PoseBuffer* pose) override;
 
     bool keepGoing() const override;
+    void reset() override;
 };
 } // namespace rive
 #endif
\ No newline at end of file
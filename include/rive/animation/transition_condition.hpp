@@ -1,6 +1,7 @@
 #ifndef _RIVE_TRANSITION_CONDITION_HPP_
 #define _RIVE_TRANSITION_CONDITION_HPP_
 #include "rive/generated/animation/transition_condition_base.hpp"
+#include "rive/animation/transition_condition_op.hpp"
 
 namespace rive
 {
@@ -20,6 +21,31 @@ public:
 protected:
     virtual bool validateInputType(const StateMachineInput* input) const { return true; }
 };
+
+/// A TransitionCondition flattened into its layer's condition table so it can
+/// be evaluated without a virtual call.
+struct CompiledTransitionCondition
+{
+    enum class Type : uint8_t
+    {
+        /// Evaluated through the condition's evaluate.
+        other,
+        boolean,
+        number,
+        trigger
+    };
+
+    Type type;
+    TransitionConditionOp op;
+    uint32_t inputId;
+    float value;
+    const TransitionCondition* condition;
+
+    static CompiledTransitionCondition compile(const TransitionCondition* condition);
+
+    /// Same result as condition->evaluate(inputInstance).
+    bool evaluate(const SMIInput* inputInstance) const;
+};
 } // namespace rive
 
 #endif
\ No newline at end of file
@@ -1,15 +1,20 @@
 #ifndef _RIVE_ARTBOARD_HPP_
 #define _RIVE_ARTBOARD_HPP_
 
+#include "rive/allocator.hpp"
 #include "rive/animation/linear_animation.hpp"
 #include "rive/animation/state_machine.hpp"
 #include "rive/core_context.hpp"
 #include "rive/generated/artboard_base.hpp"
 #include "rive/hit_info.hpp"
 #include "rive/math/aabb.hpp"
+#include "rive/name_index.hpp"
+#include "rive/profiler.hpp"
 #include "rive/renderer.hpp"
 #include "rive/shapes/shape_paint_container.hpp"
+#include "rive/world_transform_pass.hpp"
 
+#include <memory>
 #include <queue>
 #include <vector>
 
@@ -27,6 +32,7 @@ class LinearAnimationInstance;
 class Scene;
 class StateMachineInstance;
 class Joystick;
+class Executor;
 
 class Artboard : public ArtboardBase, public CoreContext, public ShapePaintContainer
 {
@@ -35,10 +41,28 @@ class Artboard : public ArtboardBase, public CoreContext, public ShapePaintConta
     friend class Component;
 
 private:
+    // Declared first so it's destroyed last, after the objects allocated
+    // from it.
+    rcp<Allocator> m_Allocator;
     std::vector<Core*> m_Objects;
     std::vector<LinearAnimation*> m_Animations;
     std::vector<StateMachine*> m_StateMachines;
     std::vector<Component*> m_DependencyOrder;
+    /// One bit per entry in m_DependencyOrder (indexed by graphOrder), set
+    /// when that component has been dirtied since it last updated. Lets
+    /// updateComponents skip straight to the dirty components instead of
+    /// walking the whole graph.
+    std::vector<uint64_t> m_DirtyComponents;
+    /// Updates the transforms that don't depend on constraints a level of
+    /// the hierarchy at a time, before the rest of the components update.
+    WorldTransformPass m_WorldTransformPass;
+    /// Set by updateInParallel: the components grouped by dependency level,
+    /// and what updating a level's on several threads needs.
+    struct ParallelUpdate;
+    std::unique_ptr<ParallelUpdate> m_ParallelUpdate;
+    /// Set while a level updates on several threads, components queue the
+    /// dirt they add there and it's applied once the level's done.
+    ParallelUpdate* m_DeferredDirt = nullptr;
     std::vector<Drawable*> m_Drawables;
     std::vector<DrawTarget*> m_DrawTargets;
     std::vector<NestedArtboard*> m_NestedArtboards;
@@ -53,22 +77,64 @@ private:
     bool m_IsInstance = false;
     bool m_FrameOrigin = true;
 
+    // The graph order, draw target order and flattened draw rules are the
+    // same for every instance of an artboard, so the source artboard records
+    // them as indices into m_Objects and instances remap them instead of
+    // sorting again. m_DrawRulesIndices has one entry per drawable (0 when it
+    // has no draw rules).
+    std::vector<uint32_t> m_DependencyOrderIndices;
+    std::vector<uint32_t> m_DrawTargetIndices;
+    std::vector<uint32_t> m_DrawRulesIndices;
+    // The artboard instances were made from, which holds the indices above.
+    const Artboard* m_Source = nullptr;
+
+    // Lookups by name and type, built on the source artboard the first time
+    // they're needed and shared by its instances (whose objects, animations
+    // and state machines line up with the source's).
+    mutable NameIndex m_ObjectNames;
+    mutable TypeIndex m_ObjectTypes;
+    mutable NameIndex m_AnimationNames;
+    mutable NameIndex m_StateMachineNames;
+
+    const Artboard* source() const { return m_IsInstance ? m_Source : this; }
+    const NameIndex& objectNames() const;
+    const TypeIndex& objectTypes() const;
+
+    // The component hierarchy flattened depth first, as ids (indices into
+    // m_Objects). A component's descendants follow it, up to (but excluding)
+    // m_HierarchyEnds[component->m_HierarchyOrder].
+    std::vector<uint32_t> m_Hierarchy;
+    std::vector<uint32_t> m_HierarchyEnds;
+
+    void buildHierarchy();
     void sortDependencies();
+    void assignGraphOrder();
     void sortDrawOrder();
+    size_t nextDirtyComponent(size_t graphOrder) const;
+    void buildDependencyLevels();
+    bool updateDependencyLevels();
+    void deferDirt(Component* component, ComponentDirt value, bool recurse);
+    void deferCollapse(Component* component, bool value);
 
     Artboard* getArtboard() override { return this; }
 
 #ifdef TESTING
 public:
-    Artboard(Factory* factory) : m_Factory(factory) {}
+    Artboard(Factory* factory);
 #endif
     void addObject(Core* object);
     void addAnimation(LinearAnimation* object);
     void addStateMachine(StateMachine* object);
 
 public:
-    Artboard() {}
+    Artboard();
     ~Artboard() override;
+
+    /// Artboards themselves always come from the heap, an instance is often
+    /// made (and destroyed) while another instance's allocator is current.
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr, size_t size);
+
     StatusCode initialize();
 
     Core* resolve(uint32_t id) const override;
@@ -79,6 +145,16 @@ public:
 
     Factory* factory() const { return m_Factory; }
 
+    /// Appends the ids of component and of all its descendants (its children,
+    /// their children...) to ids, in ascending order. Lets components find
+    /// what's parented to them without scanning every object, from
+    /// onAddedClean on.
+    void subtreeIds(const Component* component, std::vector<uint32_t>& ids) const;
+
+    /// The allocator this instance's objects (and its scenes' state) come
+    /// from, nullptr for the heap (source artboards).
+    Allocator* allocator() const { return m_Allocator.get(); }
+
     // EXPERIMENTAL -- for internal testing only for now.
     // DO NOT RELY ON THIS as it may change/disappear in the future.
     Core* hitTest(HitInfo*, const Mat2D* = nullptr);
@@ -87,6 +163,21 @@ public:
 
     /// Update components that depend on each other in DAG order.
     bool updateComponents();
+
+    /// Opts in to updating components on several threads. Components are
+    /// grouped by dependency level (each level only depending on earlier
+    /// ones) and the dirty components of a wide enough level update
+    /// together, split across executor and the calling thread into up to
+    /// threadCount groups. Dirt added while a level updates on several
+    /// threads is held back until the whole level's done. When it lands on
+    /// a component of that level or an earlier one, the rest of the update
+    /// falls back to the serial, dependency ordered loop. A nullptr executor or a threadCount
+    /// below 2 turns it back off.
+    ///
+    /// Components of a level must only touch what they own (as they do in
+    /// the runtime) and the artboard's Factory must be safe to call from
+    /// several threads.
+    void updateInParallel(Executor* executor, size_t threadCount);
     void update(ComponentDirt value) override;
     void onDirty(ComponentDirt dirt) override;
 
@@ -104,6 +195,13 @@ public:
 #ifdef TESTING
     RenderPath* clipPath() const { return m_ClipPath.get(); }
     RenderPath* backgroundPath() const { return m_BackgroundPath.get(); }
+    const WorldTransformPass& worldTransformPass() const { return m_WorldTransformPass; }
+    /// Turning the pass off leaves every transform to its component's
+    /// update.
+    void useWorldTransformPass(bool value)
+    {
+        m_WorldTransformPass.build(value ? m_DependencyOrder : std::vector<Component*>());
+    }
 #endif
 
     const std::vector<Core*>& objects() const { return m_Objects; }
@@ -115,27 +213,37 @@ public:
     bool isTranslucent(const LinearAnimation*) const;
     bool isTranslucent(const LinearAnimationInstance*) const;
 
+    // The name lookups take a StringView, the std::string and C string
+    // overloads forward to it without copying the name. The C string ones
+    // are templates so that a literal 0 still picks the index overloads.
+    template <typename T = Component> T* find(StringView name)
+    {
+        const std::vector<Core*>& objects = m_Objects;
+        size_t index = objectNames().find(name, [&](size_t i) {
+            Core* object = objects[i];
+            return object->is<T>() && name == object->as<T>()->name();
+        });
+        return index == NameIndex::npos ? nullptr : static_cast<T*>(m_Objects[index]);
+    }
     template <typename T = Component> T* find(const std::string& name)
     {
-        for (auto object : m_Objects)
-        {
-            if (object != nullptr && object->is<T>() && object->as<T>()->name() == name)
-            {
-                return static_cast<T*>(object);
-            }
-        }
-        return nullptr;
+        return find<T>(StringView(name));
+    }
+    template <typename T = Component, typename C> T* find(const C* name)
+    {
+        return find<T>(StringView(name));
     }
 
     template <typename T = Component> std::vector<T*> find()
     {
+        std::vector<uint32_t> indices;
+        const std::vector<Core*>& objects = m_Objects;
+        objectTypes().find([&](size_t i) { return objects[i]->is<T>(); }, indices);
         std::vector<T*> results;
-        for (auto object : m_Objects)
+        results.reserve(indices.size());
+        for (auto index : indices)
         {
-            if (object != nullptr && object->is<T>())
-            {
-                results.push_back(static_cast<T*>(object));
-            }
+            results.push_back(static_cast<T*>(m_Objects[index]));
         }
         return results;
     }
@@ -147,11 +255,27 @@ public:
     std::string stateMachineNameAt(size_t index) const;
 
     LinearAnimation* firstAnimation() const { return animation(0); }
-    LinearAnimation* animation(const std::string& name) const;
+    LinearAnimation* animation(StringView name) const;
+    LinearAnimation* animation(const std::string& name) const
+    {
+        return animation(StringView(name));
+    }
+    template <typename C> LinearAnimation* animation(const C* name) const
+    {
+        return animation(StringView(name));
+    }
     LinearAnimation* animation(size_t index) const;
 
     StateMachine* firstStateMachine() const { return stateMachine(0); }
-    StateMachine* stateMachine(const std::string& name) const;
+    StateMachine* stateMachine(StringView name) const;
+    StateMachine* stateMachine(const std::string& name) const
+    {
+        return stateMachine(StringView(name));
+    }
+    template <typename C> StateMachine* stateMachine(const C* name) const
+    {
+        return stateMachine(StringView(name));
+    }
     StateMachine* stateMachine(size_t index) const;
 
     /// When provided, the designer has specified that this artboard should
@@ -159,15 +283,22 @@ public:
     // provided.
     int defaultStateMachineIndex() const;
 
-    /// Make an instance of this artboard.
-    template <typename T = ArtboardInstance> std::unique_ptr<T> instance() const
+    /// Make an instance of this artboard. Its objects, and the runtime state
+    /// of the scenes made from it, are allocated from allocator, or a new
+    /// ArenaAllocator when none is provided.
+    template <typename T = ArtboardInstance>
+    std::unique_ptr<T> instance(rcp<Allocator> allocator = nullptr) const
     {
+        RIVE_PROFILE_SCOPE(instance);
         std::unique_ptr<T> artboardClone(new T);
+        artboardClone->m_Allocator = allocator ? std::move(allocator) : make_rcp<ArenaAllocator>();
+        AllocatorScope scope(artboardClone->m_Allocator.get());
         artboardClone->copy(*this);
 
         artboardClone->m_Factory = m_Factory;
         artboardClone->m_FrameOrigin = m_FrameOrigin;
         artboardClone->m_IsInstance = true;
+        artboardClone->m_Source = m_IsInstance ? m_Source : this;
 
         std::vector<Core*>& cloneObjects = artboardClone->m_Objects;
         cloneObjects.push_back(artboardClone.get());
@@ -226,10 +357,14 @@ public:
     ~ArtboardInstance() override;
 
     std::unique_ptr<LinearAnimationInstance> animationAt(size_t index);
+    std::unique_ptr<LinearAnimationInstance> animationNamed(StringView name);
     std::unique_ptr<LinearAnimationInstance> animationNamed(const std::string& name);
+    std::unique_ptr<LinearAnimationInstance> animationNamed(const char* name);
 
     std::unique_ptr<StateMachineInstance> stateMachineAt(size_t index);
+    std::unique_ptr<StateMachineInstance> stateMachineNamed(StringView name);
     std::unique_ptr<StateMachineInstance> stateMachineNamed(const std::string& name);
+    std::unique_ptr<StateMachineInstance> stateMachineNamed(const char* name);
 
     /// When provided, the designer has specified that this artboard should
     /// always autoplay this StateMachine instance. If it was not specified,
@@ -8,7 +8,9 @@ namespace rive
 class FileAssetContents : public FileAssetContentsBase
 {
 private:
-    std::vector<uint8_t> m_Bytes;
+    /// Contents only live while the file is being imported, so they can
+    /// refer to the bytes being imported rather than copying them.
+    Span<const uint8_t> m_Bytes;
 
 public:
     Span<const uint8_t> bytes() const;
@@ -0,0 +1,28 @@
+#ifndef _RIVE_UNIQUE_ASSET_IDS_HPP_
+#define _RIVE_UNIQUE_ASSET_IDS_HPP_
+
+#include <cstdint>
+#include <unordered_set>
+
+namespace rive
+{
+/// Makes file asset ids unique as the assets are read, working around an
+/// editor bug that exported duplicates:
+/// https://github.com/rive-app/rive/issues/4204
+///
+/// Shared by BackboardImporter and FileMetadata::scan so both report the
+/// same ids.
+class UniqueAssetIds
+{
+public:
+    /// Returns id if no asset added before had it, otherwise an id higher
+    /// than any added so far. Assets added before are never renamed.
+    uint32_t add(uint32_t id);
+
+private:
+    std::unordered_set<uint32_t> m_Ids;
+    uint32_t m_NextId = 1;
+};
+} // namespace rive
+
+#endif
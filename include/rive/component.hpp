@@ -3,22 +3,27 @@
 #include "rive/component_dirt.hpp"
 #include "rive/generated/component_base.hpp"
 
+#include <limits>
 #include <vector>
 
 namespace rive
 {
 class ContainerComponent;
 class Artboard;
+class WorldTransformPass;
 
 class Component : public ComponentBase
 {
     friend class Artboard;
+    friend class WorldTransformPass;
 
 private:
     ContainerComponent* m_Parent = nullptr;
     std::vector<Component*> m_Dependents;
 
-    unsigned int m_GraphOrder;
+    unsigned int m_GraphOrder = std::numeric_limits<unsigned int>::max();
+    /// Position in the artboard's flattened hierarchy.
+    uint32_t m_HierarchyOrder = std::numeric_limits<uint32_t>::max();
     Artboard* m_Artboard = nullptr;
 
 protected:
@@ -15,6 +15,13 @@ public:
     const uint32_t emptyId = -1;
     static const int invalidPropertyKey = 0;
     virtual ~Core() {}
+
+    /// Objects come from Allocator::current() (the heap when there is
+    /// none) with no header, so they must be deleted with the same allocator
+    /// current. Only ArtboardInstance makes one current for them, while it
+    /// clones and initializes its objects and while it deletes them.
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr, size_t size);
     virtual uint16_t coreType() const = 0;
     virtual bool isTypeOf(uint16_t typeKey) const = 0;
     virtual bool deserialize(uint16_t propertyKey, BinaryReader& reader) = 0;
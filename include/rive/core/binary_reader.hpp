@@ -19,6 +19,7 @@ private:
 
     void overflow();
     void intRangeError();
+    uint64_t decodeVarUint64();
 
 public:
     explicit BinaryReader(Span<const uint8_t>);
@@ -35,7 +36,16 @@ public:
     float readFloat32();
     uint8_t readByte();
     uint32_t readUint32();
-    uint64_t readVarUint64(); // Reads a LEB128 encoded uint64_t
+    // Reads a LEB128 encoded uint64_t
+    uint64_t readVarUint64()
+    {
+        // Keys and small values are a single byte, read those without a call.
+        if (m_Position < m_Bytes.end() && *m_Position < 0x80)
+        {
+            return *m_Position++;
+        }
+        return decodeVarUint64();
+    }
 
     // This will cast the uint read to the requested size, but if the
     // raw value was out-of-range, instead returns 0 and sets the IntRangeError.
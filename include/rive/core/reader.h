@@ -1,3 +1,4 @@
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -12,9 +13,10 @@ static bool is_big_endian(void)
     return bint.c[0] == 1;
 }
 
-/* Decode an unsigned int LEB128 at buf into r, returning the nr of bytes read.
+/* Decode an unsigned int LEB128 at buf into r, one byte at a time, checking
+ * each one is before buf_end. Returns the nr of bytes read, 0 on overflow.
  */
-inline size_t decode_uint_leb(const uint8_t* buf, const uint8_t* buf_end, uint64_t* r)
+inline size_t decode_uint_leb_checked(const uint8_t* buf, const uint8_t* buf_end, uint64_t* r)
 {
     const uint8_t* p = buf;
     uint8_t shift = 0;
@@ -28,13 +30,57 @@ inline size_t decode_uint_leb(const uint8_t* buf, const uint8_t* buf_end, uint64
             return 0;
         }
         byte = *p++;
-        result |= ((uint64_t)(byte & 0x7f)) << shift;
+        if (shift < 64)
+        {
+            result |= ((uint64_t)(byte & 0x7f)) << shift;
+        }
         shift += 7;
     } while ((byte & 0x80) != 0);
     *r = result;
     return p - buf;
 }
 
+/* Decode an unsigned int LEB128 at buf into r, returning the nr of bytes read.
+ *
+ * Keys and most values fit in one or two bytes, which are decoded without
+ * looping. Longer ones skip the per byte bounds check when there's room for
+ * the longest (10 byte) encoding of a uint64_t.
+ */
+inline size_t decode_uint_leb(const uint8_t* buf, const uint8_t* buf_end, uint64_t* r)
+{
+    ptrdiff_t available = buf_end - buf;
+    if (available >= 2)
+    {
+        uint64_t b0 = buf[0];
+        uint64_t b1 = buf[1];
+        if (b0 < 0x80)
+        {
+            *r = b0;
+            return 1;
+        }
+        if (b1 < 0x80)
+        {
+            *r = (b0 & 0x7f) | (b1 << 7);
+            return 2;
+        }
+        if (available >= 10)
+        {
+            uint64_t result = (b0 & 0x7f) | ((b1 & 0x7f) << 7);
+            for (int i = 2; i < 10; i++)
+            {
+                uint64_t byte = buf[i];
+                result |= (byte & 0x7f) << (7 * i);
+                if (byte < 0x80)
+                {
+                    *r = result;
+                    return i + 1;
+                }
+            }
+        }
+    }
+    return decode_uint_leb_checked(buf, buf_end, r);
+}
+
 /* Decodes a string
  */
 inline uint64_t decode_string(uint64_t str_len,
@@ -66,6 +112,10 @@ inline size_t decode_float(const uint8_t* buf, const uint8_t* buf_end, float* r)
     {
         return 0;
     }
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    // Known to be little endian at compile time, same as the file.
+    memcpy(r, buf, sizeof(float));
+#else
     if (is_big_endian())
     {
         uint8_t inverted[4] = {buf[3], buf[2], buf[1], buf[0]};
@@ -75,6 +125,7 @@ inline size_t decode_float(const uint8_t* buf, const uint8_t* buf_end, float* r)
     {
         memcpy(r, buf, sizeof(float));
     }
+#endif
     return sizeof(float);
 }
 
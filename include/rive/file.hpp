@@ -16,6 +16,9 @@ namespace rive
 class BinaryReader;
 class RuntimeHeader;
 class Factory;
+class ImportStack;
+class Executor;
+class AssetDecodeJobs;
 
 ///
 /// Tracks the success/failure result when importing a Rive file.
@@ -30,6 +33,41 @@ enum class ImportResult
     malformed
 };
 
+///
+/// Options for importing a Rive file.
+///
+struct ImportOptions
+{
+    /// Only read an artboard's components, animations and state machines the
+    /// first time the artboard is asked for (through artboard(),
+    /// artboardNamed(), etc.). Everything else, like the file's assets and
+    /// the artboards' names, is still read by File::import.
+    ///
+    /// Loading an artboard on demand isn't thread-safe, a file imported this
+    /// way shouldn't be asked for artboards from several threads at once.
+    bool lazyArtboards = false;
+
+    /// The caller guarantees the bytes passed to File::import outlive the
+    /// File, so the File refers to them rather than copying what it reads
+    /// later, like the objects of lazily read artboards. MappedFile maps a
+    /// file's bytes for importing this way.
+    bool bytesOutliveFile = false;
+
+    /// Decodes the file's images and fonts on this executor (a WorkerPool,
+    /// or one wrapping the caller's own threads) while the rest of the file
+    /// is read, rather than one after the other as they're read. File::import
+    /// still returns once every asset is decoded. The factory's decodeImage
+    /// and decodeFont must be safe to call from the executor's threads.
+    Executor* assetDecodeExecutor = nullptr;
+
+    /// Loads the assets not provided in band after the file's been read,
+    /// all at once, rather than through the File's FileAssetResolver as
+    /// each one is read. File::import returns without waiting for them, see
+    /// File::assetsPending. The file's artboards shouldn't be used until
+    /// they're loaded.
+    AsyncFileAssetResolver* asyncAssetResolver = nullptr;
+};
+
 ///
 /// A Rive file.
 ///
@@ -53,12 +91,28 @@ private:
     /// Rive components and animations.
     std::vector<std::unique_ptr<Artboard>> m_Artboards;
 
+    /// Artboards by name, built the first time one is looked up.
+    mutable NameIndex m_ArtboardNames;
+
+    /// What's left to read of the artboards when importing them lazily,
+    /// nullptr otherwise.
+    struct LazyImport;
+    std::unique_ptr<LazyImport> m_LazyImport;
+
     Factory* m_Factory;
 
     /// The helper used to resolve assets when they're not provided in-band
     /// with the file.
     FileAssetResolver* m_AssetResolver;
 
+    /// The jobs decoding assets while the file is imported, if any.
+    AssetDecodeJobs* m_AssetDecodeJobs = nullptr;
+
+    /// Tracks the assets being loaded by an AsyncFileAssetResolver, shared
+    /// with the callback it calls when it's done.
+    struct PendingAssets;
+    std::shared_ptr<PendingAssets> m_PendingAssets;
+
     File(Factory*, FileAssetResolver*);
 
 public:
@@ -70,11 +124,13 @@ public:
     /// @param result is an optional status result.
     /// @param assetResolver is an optional helper to resolve assets which
     /// cannot be found in-band.
+    /// @param options how to import the file.
     /// @returns a pointer to the file, or null on failure.
     static std::unique_ptr<File> import(Span<const uint8_t> data,
                                         Factory*,
                                         ImportResult* result = nullptr,
-                                        FileAssetResolver* assetResolver = nullptr);
+                                        FileAssetResolver* assetResolver = nullptr,
+                                        const ImportOptions& options = ImportOptions());
 
     /// @returns the file's backboard. All files have exactly one backboard.
     Backboard* backboard() const { return m_Backboard.get(); }
@@ -85,21 +141,48 @@ public:
 
     std::vector<const FileAsset*> assets() const;
 
+    /// @returns whether the ImportOptions::asyncAssetResolver the file was
+    /// imported with is still loading its assets.
+    bool assetsPending() const;
+
+    /// Blocks until the ImportOptions::asyncAssetResolver the file was
+    /// imported with has loaded its assets.
+    void waitForAssets() const;
+
     // Instances
     std::unique_ptr<ArtboardInstance> artboardDefault() const;
     std::unique_ptr<ArtboardInstance> artboardAt(size_t index) const;
-    std::unique_ptr<ArtboardInstance> artboardNamed(std::string name) const;
+    std::unique_ptr<ArtboardInstance> artboardNamed(StringView name) const;
+    std::unique_ptr<ArtboardInstance> artboardNamed(std::string name) const
+    {
+        return artboardNamed(StringView(name));
+    }
+    template <typename C> std::unique_ptr<ArtboardInstance> artboardNamed(const C* name) const
+    {
+        return artboardNamed(StringView(name));
+    }
 
     Artboard* artboard() const;
 
     /// @returns the named artboard. If no artboard is found with that name,
     /// the null pointer is returned.
-    Artboard* artboard(std::string name) const;
+    Artboard* artboard(StringView name) const;
+    Artboard* artboard(std::string name) const { return artboard(StringView(name)); }
+    template <typename C> Artboard* artboard(const C* name) const
+    {
+        return artboard(StringView(name));
+    }
 
     /// @returns the artboard at the specified index, or the nullptr if the
     /// index is out of range.
     Artboard* artboard(size_t index) const;
 
+#ifdef TESTING
+    /// Whether the artboard at index has been read (always true unless
+    /// importing with ImportOptions::lazyArtboards).
+    bool isArtboardLoaded(size_t index) const;
+#endif
+
 #ifdef WITH_RIVE_TOOLS
     /// Strips FileAssetContents for FileAssets of given typeKeys.
     /// @param data the raw data of the file.
@@ -112,7 +195,13 @@ public:
 #endif
 
 private:
-    ImportResult read(BinaryReader&, const RuntimeHeader&);
+    ImportResult read(BinaryReader&, const RuntimeHeader&, const ImportOptions&);
+    ImportResult readAndResolve(BinaryReader&, const RuntimeHeader&, Executor*);
+    ImportResult readObjects(BinaryReader&, const RuntimeHeader&, ImportStack&);
+
+    /// Returns the artboard at index, first reading it if it was imported
+    /// lazily. nullptr if it fails to read.
+    Artboard* loadArtboard(size_t index) const;
 };
 } // namespace rive
 #endif
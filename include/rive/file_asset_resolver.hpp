@@ -2,6 +2,7 @@
 #define _RIVE_FILE_ASSET_RESOLVER_HPP_
 
 #include <cstdint>
+#include <functional>
 #include <vector>
 
 namespace rive
@@ -18,5 +19,20 @@ public:
     /// contents of.
     virtual void loadContents(FileAsset& asset) = 0;
 };
+
+/// Finds the contents of every asset not provided in band at once, after the
+/// file's been read, so they can be fetched and decoded concurrently while
+/// the caller carries on.
+class AsyncFileAssetResolver
+{
+public:
+    virtual ~AsyncFileAssetResolver() {}
+
+    /// Expected to be overridden to start loading the contents of assets,
+    /// calling done (from any thread) once every one of them is loaded or
+    /// has been given up on. The file waits for done before it's destroyed.
+    /// @param assets the assets that Rive is looking for the contents of.
+    virtual void loadContents(std::vector<FileAsset*> assets, std::function<void()> done) = 0;
+};
 } // namespace rive
 #endif
@@ -0,0 +1,79 @@
+#ifndef _RIVE_FILE_METADATA_HPP_
+#define _RIVE_FILE_METADATA_HPP_
+
+#include "rive/file.hpp"
+#include "rive/span.hpp"
+#include <string>
+#include <vector>
+
+namespace rive
+{
+struct LinearAnimationMetadata
+{
+    std::string name;
+    // Defaults match LinearAnimationBase's.
+    uint32_t fps = 60;
+    uint32_t duration = 60;
+    float speed = 1.0f;
+    uint32_t loopValue = 0;
+    uint32_t workStart = -1;
+    uint32_t workEnd = -1;
+    bool enableWorkArea = false;
+
+    /// Same as LinearAnimation::durationSeconds.
+    float durationSeconds() const;
+};
+
+struct StateMachineInputMetadata
+{
+    std::string name;
+    /// The input's coreType, StateMachineBool, StateMachineNumber or
+    /// StateMachineTrigger's typeKey.
+    uint16_t coreType = 0;
+};
+
+struct StateMachineMetadata
+{
+    std::string name;
+    std::vector<StateMachineInputMetadata> inputs;
+};
+
+struct ArtboardMetadata
+{
+    std::string name;
+    float width = 0.0f;
+    float height = 0.0f;
+    std::vector<LinearAnimationMetadata> animations;
+    std::vector<StateMachineMetadata> stateMachines;
+};
+
+struct FileAssetMetadata
+{
+    std::string name;
+    /// The asset's coreType, ImageAsset or FontAsset's typeKey.
+    uint16_t coreType = 0;
+    uint32_t assetId = 0;
+    /// Whether the asset's contents are in the file, and how many bytes
+    /// they are.
+    bool inBand = false;
+    size_t contentsSize = 0;
+};
+
+///
+/// What's in a Rive file: its artboards' names and sizes, their animations
+/// and state machines, and its assets.
+///
+struct FileMetadata
+{
+    std::vector<ArtboardMetadata> artboards;
+    std::vector<FileAssetMetadata> assets;
+
+    /// Reads the metadata of a Rive file by walking its objects, without
+    /// making them, decoding assets or initializing artboards.
+    /// @returns the same result File::import would, other than for errors
+    /// found importing the objects themselves.
+    static ImportResult scan(Span<const uint8_t> data, FileMetadata* metadata);
+};
+} // namespace rive
+
+#endif
@@ -22,6 +22,9 @@ class HitTestCommandPath : public CommandPath
 public:
     HitTestCommandPath(const IAABB& area);
 
+    /// Starts over on a new area, keeping the memory of the last one.
+    void reset(const IAABB& area);
+
     // can call this between calls to move/line/etc.
     void setXform(const Mat2D& xform) { m_Xform = xform; }
 
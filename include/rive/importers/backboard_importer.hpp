@@ -1,6 +1,7 @@
 #ifndef _RIVE_BACKBOARD_IMPORTER_HPP_
 #define _RIVE_BACKBOARD_IMPORTER_HPP_
 
+#include "rive/assets/unique_asset_ids.hpp"
 #include "rive/importers/import_stack.hpp"
 #include <unordered_map>
 #include <vector>
@@ -20,6 +21,7 @@ private:
     std::vector<NestedArtboard*> m_NestedArtboards;
     std::vector<FileAsset*> m_FileAssets;
     std::vector<FileAssetReferencer*> m_FileAssetReferencers;
+    UniqueAssetIds m_FileAssetIds;
     int m_NextArtboardId;
 
 public:
@@ -27,6 +29,9 @@ public:
     void addArtboard(Artboard* artboard);
     void addMissingArtboard();
     void addNestedArtboard(NestedArtboard* artboard);
+    /// Gives asset a unique id, if it doesn't have one already, before its
+    /// contents are read (and maybe decoded on another thread). Assets added
+    /// earlier are never changed.
     void addFileAsset(FileAsset* asset);
     void addFileAssetReferencer(FileAssetReferencer* referencer);
 
@@ -2,6 +2,9 @@
 #define _RIVE_FILE_ASSET_IMPORTER_HPP_
 
 #include "rive/importers/import_stack.hpp"
+#include "rive/span.hpp"
+#include <condition_variable>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -11,6 +14,32 @@ class FileAsset;
 class FileAssetContents;
 class FileAssetResolver;
 class Factory;
+class Executor;
+
+/// Decodes the contents of a file's assets through an Executor while the
+/// rest of the file is read.
+class AssetDecodeJobs
+{
+private:
+    Executor* m_Executor;
+    Factory* m_Factory;
+    std::mutex m_Mutex;
+    std::condition_variable m_JobDone;
+    size_t m_Pending = 0;
+    std::vector<FileAsset*> m_Failed;
+
+public:
+    AssetDecodeJobs(Executor*, Factory*);
+    /// Waits for the jobs still running.
+    ~AssetDecodeJobs();
+
+    /// Decodes bytes into asset on the executor, bytes must stay valid
+    /// until wait returns.
+    void decode(FileAsset* asset, Span<const uint8_t> bytes);
+
+    /// Waits for every job, returning the assets that failed to decode.
+    std::vector<FileAsset*> wait();
+};
 
 class FileAssetImporter : public ImportStackObject
 {
@@ -19,11 +48,17 @@ private:
     FileAsset* m_FileAsset;
     FileAssetResolver* m_FileAssetResolver;
     Factory* m_Factory;
+    AssetDecodeJobs* m_DecodeJobs;
     // we will delete this when we go out of scope
     std::unique_ptr<FileAssetContents> m_Content;
 
 public:
-    FileAssetImporter(FileAsset*, FileAssetResolver*, Factory*);
+    /// Contents are decoded through decodeJobs when given, otherwise as
+    /// soon as they're read.
+    FileAssetImporter(FileAsset*,
+                      FileAssetResolver*,
+                      Factory*,
+                      AssetDecodeJobs* decodeJobs = nullptr);
     void loadContents(std::unique_ptr<FileAssetContents> contents);
     StatusCode resolve() override;
 };
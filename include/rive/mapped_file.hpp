@@ -0,0 +1,35 @@
+#ifndef _RIVE_MAPPED_FILE_HPP_
+#define _RIVE_MAPPED_FILE_HPP_
+
+#include "rive/span.hpp"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace rive
+{
+/// The bytes of a local file, memory-mapped where the platform supports it
+/// and read into memory otherwise. Keep it alive for as long as a File
+/// imported from it with ImportOptions::bytesOutliveFile.
+class MappedFile
+{
+private:
+    Span<const uint8_t> m_Bytes;
+    /// Holds the bytes on platforms that can't map them.
+    std::vector<uint8_t> m_Copy;
+    bool m_Mapped = false;
+
+    MappedFile() = default;
+
+public:
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /// @returns the file at path, or null when it can't be opened.
+    static std::unique_ptr<MappedFile> open(const char* path);
+
+    Span<const uint8_t> bytes() const { return m_Bytes; }
+};
+} // namespace rive
+#endif
@@ -18,13 +18,34 @@ namespace rive
 
 class HitTester
 {
-    std::vector<int> m_DW; // width * height delta-windings
+public:
+    /// Areas with at most this many pixels (like the few pixels around a
+    /// pointer) are tested without allocating, in storage inline in the
+    /// tester.
+    static const int kInlineArea = 64;
+    /// Areas with at most this many pixels (a point, or the pixels right
+    /// around it) aren't rasterized: each pixel sums the signed crossings of
+    /// its row's center by the flattened segments, and curves entirely to
+    /// one side of the area are never flattened.
+    static const int kAnalyticArea = 4;
+
+private:
+    std::vector<int> m_DW; // width * height delta-windings for larger areas
+    int m_InlineDW[kInlineArea];
+    bool m_UsesInlineDW = false;
+    bool m_Analytic = false;
+#ifdef TESTING
+    bool m_AnalyticAreas = true;
+#endif
     Vec2D m_First, m_Prev;
     Vec2D m_offset;
     float m_height;
-    int m_IWidth, m_IHeight;
-    bool m_ExpectsMove;
+    int m_IWidth = 0, m_IHeight = 0;
+    bool m_ExpectsMove = true;
 
+    int* deltas() { return m_UsesInlineDW ? m_InlineDW : m_DW.data(); }
+    void addSegment(Vec2D p0, Vec2D p1);
+    bool cullCubic(Vec2D b, Vec2D c, Vec2D d);
     void recurse_cubic(Vec2D b, Vec2D c, Vec2D d, int count);
 
 public:
@@ -46,6 +67,12 @@ public:
 
     static bool testMesh(Vec2D point, Span<Vec2D> verts, Span<uint16_t> indices);
     static bool testMesh(const IAABB&, Span<Vec2D> verts, Span<uint16_t> indices);
+
+#ifdef TESTING
+    /// Rasterizes the areas that would be tested analytically, from the next
+    /// reset on.
+    void useAnalyticAreas(bool value) { m_AnalyticAreas = value; }
+#endif
 };
 
 } // namespace rive
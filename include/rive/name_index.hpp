@@ -0,0 +1,186 @@
+#ifndef _RIVE_NAME_INDEX_HPP_
+#define _RIVE_NAME_INDEX_HPP_
+
+#include "rive/string_view.hpp"
+#include <mutex>
+#include <vector>
+
+namespace rive
+{
+/// Hashes the names of a list of entries (objects, animations, inputs...) so
+/// looking one up by name only compares the few entries sharing its hash.
+///
+/// Only the hashes are kept, lookups confirm each candidate against the
+/// entries themselves. Candidates are tried in list order, so the first entry
+/// with a name (that matches) is found, as with a linear search.
+///
+/// Indices are shared by every instance of what they index, so they're built
+/// on first use (buildOnce) by whichever thread gets there first.
+class NameIndex
+{
+public:
+    static const size_t npos = (size_t)-1;
+
+    static uint32_t hash(StringView name)
+    {
+        // FNV-1a
+        uint32_t hash = 2166136261u;
+        for (char c : name)
+        {
+            hash = (hash ^ (uint8_t)c) * 16777619u;
+        }
+        return hash;
+    }
+
+    /// Whether build has been called.
+    bool built() const { return !m_Buckets.empty(); }
+
+    /// Indexes count entries, nameOf(index) returning a pointer to the name
+    /// of each one or nullptr for entries that can't be looked up.
+    template <typename NameOf> void build(size_t count, NameOf nameOf)
+    {
+        size_t bucketCount = 1;
+        while (bucketCount < count)
+        {
+            bucketCount <<= 1;
+        }
+        m_Buckets.assign(bucketCount, 0);
+        m_Next.assign(count, 0);
+        m_Hashes.assign(count, 0);
+        // Insert from the back so each bucket lists its entries in order.
+        for (size_t i = count; i-- > 0;)
+        {
+            const std::string* name = nameOf(i);
+            if (name == nullptr)
+            {
+                continue;
+            }
+            uint32_t hash = NameIndex::hash(*name);
+            uint32_t& bucket = m_Buckets[hash & (bucketCount - 1)];
+            m_Hashes[i] = hash;
+            m_Next[i] = bucket;
+            bucket = (uint32_t)i + 1;
+        }
+    }
+
+    /// Calls build the first time it's called, other callers wait for it to
+    /// finish.
+    template <typename NameOf> void buildOnce(size_t count, NameOf nameOf)
+    {
+        std::call_once(m_Once, [&]() { build(count, nameOf); });
+    }
+
+    /// Returns the index of the first entry named name for which
+    /// matches(index) returns true, npos when there's none. matches is
+    /// responsible for comparing the entry's name.
+    template <typename Matches> size_t find(StringView name, Matches matches) const
+    {
+        assert(built());
+        uint32_t hash = NameIndex::hash(name);
+        uint32_t entry = m_Buckets[hash & (m_Buckets.size() - 1)];
+        while (entry != 0)
+        {
+            size_t index = entry - 1;
+            if (m_Hashes[index] == hash && matches(index))
+            {
+                return index;
+            }
+            entry = m_Next[index];
+        }
+        return npos;
+    }
+
+private:
+    /// Index + 1 of the first entry in each bucket, 0 for empty buckets.
+    std::vector<uint32_t> m_Buckets;
+    /// Index + 1 of the next entry in the same bucket, 0 for the last one.
+    std::vector<uint32_t> m_Next;
+    std::vector<uint32_t> m_Hashes;
+    std::once_flag m_Once;
+};
+
+/// Groups the indices of a list of core objects by their coreType, so finding
+/// the objects of a type only checks the type of one object per coreType.
+class TypeIndex
+{
+public:
+    /// Whether build has been called.
+    bool built() const { return m_Built; }
+
+    /// Indexes count entries, typeOf(index) returning the coreType of each
+    /// one, or 0 for entries to leave out.
+    template <typename TypeOf> void build(size_t count, TypeOf typeOf)
+    {
+        m_Indices.clear();
+        m_Runs.clear();
+        std::vector<std::pair<uint16_t, uint32_t>> sorted;
+        sorted.reserve(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            uint16_t type = typeOf(i);
+            if (type != 0)
+            {
+                sorted.push_back({type, (uint32_t)i});
+            }
+        }
+        std::sort(sorted.begin(), sorted.end());
+        m_Indices.reserve(sorted.size());
+        for (auto& entry : sorted)
+        {
+            if (m_Runs.empty() || m_Runs.back().type != entry.first)
+            {
+                m_Runs.push_back({entry.first, (uint32_t)m_Indices.size()});
+            }
+            m_Indices.push_back(entry.second);
+        }
+        m_Runs.push_back({0, (uint32_t)m_Indices.size()});
+        m_Built = true;
+    }
+
+    /// Calls build the first time it's called, other callers wait for it to
+    /// finish.
+    template <typename TypeOf> void buildOnce(size_t count, TypeOf typeOf)
+    {
+        std::call_once(m_Once, [&]() { build(count, typeOf); });
+    }
+
+    /// Appends the indices of the entries whose coreType isType(index)
+    /// accepts (checked on one index of each coreType) to results, in order.
+    template <typename IsType> void find(IsType isType, std::vector<uint32_t>& results) const
+    {
+        assert(built());
+        size_t start = results.size();
+        size_t runCount = 0;
+        for (size_t i = 0; i + 1 < m_Runs.size(); i++)
+        {
+            uint32_t from = m_Runs[i].start;
+            uint32_t to = m_Runs[i + 1].start;
+            if (isType(m_Indices[from]))
+            {
+                results.insert(results.end(), m_Indices.begin() + from, m_Indices.begin() + to);
+                runCount++;
+            }
+        }
+        if (runCount > 1)
+        {
+            std::sort(results.begin() + start, results.end());
+        }
+    }
+
+private:
+    struct Run
+    {
+        uint16_t type;
+        /// Offset of the run's first index in m_Indices.
+        uint32_t start;
+    };
+    /// Indices of the entries, sorted by coreType then index.
+    std::vector<uint32_t> m_Indices;
+    /// One run per coreType, followed by an end marker.
+    std::vector<Run> m_Runs;
+    bool m_Built = false;
+    std::once_flag m_Once;
+};
+} // namespace rive
+
+#endif
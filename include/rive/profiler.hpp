@@ -0,0 +1,137 @@
+#ifndef _RIVE_PROFILER_HPP_
+#define _RIVE_PROFILER_HPP_
+
+#include "rive/component_dirt.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace rive
+{
+/// The parts of loading and playing a file that are timed.
+enum class ProfilePhase : uint8_t
+{
+    import,
+    instance,
+    advance,
+    keyFrameApply,
+    updateComponents,
+    pathRebuild,
+    hitTest,
+    textShaping,
+    draw,
+};
+
+/// A timed scope, in nanoseconds since the profiler was first used.
+struct ProfileEvent
+{
+    ProfilePhase phase;
+    /// Numbered in the order threads first record something, from 0.
+    uint32_t thread;
+    uint64_t start;
+    uint64_t duration;
+};
+
+/// Everything recorded between two calls to Profiler::endFrame.
+struct ProfileFrame
+{
+    static const int kDirtCount = 11;
+
+    uint64_t start = 0;
+    uint64_t end = 0;
+    /// In the order the scopes ended, so nested scopes come before the ones
+    /// holding them.
+    std::vector<ProfileEvent> events;
+    /// Components updated by Artboard::updateComponents, per bit of the
+    /// ComponentDirt they were updated for.
+    uint32_t componentUpdates[kDirtCount] = {};
+
+    /// Total time spent in phase's scopes, nested ones of the same phase
+    /// (like a nested artboard's advance) included in their parent only.
+    uint64_t duration(ProfilePhase phase) const;
+    /// Number of scopes recorded for phase, nested ones included.
+    size_t count(ProfilePhase phase) const;
+};
+
+/// Collects timings of the phases above and counts of component updates,
+/// a frame at a time, from every thread.
+///
+/// The scopes are only compiled in with WITH_RIVE_PROFILING defined, without
+/// it the macros below are empty and frames are always empty. With it,
+/// nothing is recorded until the profiler is enabled, scopes only check a
+/// flag until then.
+class Profiler
+{
+public:
+    static void enable(bool value);
+    static bool enabled();
+
+    /// Returns what was recorded since the last call (or since the profiler
+    /// was enabled) and starts a new frame.
+    static ProfileFrame endFrame();
+
+    /// Frames as Chrome trace event JSON, which chrome://tracing and
+    /// Perfetto open: a complete event per scope, a counter event with the
+    /// component updates and an instant event at the end of each frame.
+    static std::string chromeTrace(const std::vector<ProfileFrame>& frames);
+
+    static const char* name(ProfilePhase phase);
+    /// Name of bit dirtBit of ComponentDirt, as counted in ProfileFrame.
+    static const char* dirtName(int dirtBit);
+
+    /// Used by the macros below.
+    static uint64_t now();
+    static void record(ProfilePhase phase, uint64_t start, uint64_t end);
+    static void countUpdate(ComponentDirt dirt);
+};
+
+/// Records the time from its construction to its destruction.
+class ProfileScope
+{
+public:
+    explicit ProfileScope(ProfilePhase phase) :
+        m_Phase(phase), m_Recording(Profiler::enabled()), m_Start(m_Recording ? Profiler::now() : 0)
+    {}
+    ~ProfileScope()
+    {
+        if (m_Recording)
+        {
+            Profiler::record(m_Phase, m_Start, Profiler::now());
+        }
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    ProfilePhase m_Phase;
+    bool m_Recording;
+    uint64_t m_Start;
+};
+} // namespace rive
+
+#ifdef WITH_RIVE_PROFILING
+#define RIVE_PROFILE_CONCAT_(A, B) A##B
+#define RIVE_PROFILE_CONCAT(A, B) RIVE_PROFILE_CONCAT_(A, B)
+/// Times the rest of the enclosing scope as ProfilePhase::PHASE.
+#define RIVE_PROFILE_SCOPE(PHASE)                                                                  \
+    ::rive::ProfileScope RIVE_PROFILE_CONCAT(riveProfileScope, __LINE__)(                          \
+        ::rive::ProfilePhase::PHASE)
+/// Counts a component updated for DIRT.
+#define RIVE_PROFILE_COMPONENT_UPDATE(DIRT)                                                        \
+    do                                                                                             \
+    {                                                                                              \
+        if (::rive::Profiler::enabled())                                                           \
+        {                                                                                          \
+            ::rive::Profiler::countUpdate(DIRT);                                                   \
+        }                                                                                          \
+    } while (0)
+#else
+#define RIVE_PROFILE_SCOPE(PHASE)
+#define RIVE_PROFILE_COMPONENT_UPDATE(DIRT)                                                        \
+    do                                                                                             \
+    {                                                                                              \
+    } while (0)
+#endif
+
+#endif
@@ -2,6 +2,7 @@
 #define _RIVE_RELATIVE_LOCAL_ASSET_RESOLVER_HPP_
 
 #include "rive/file_asset_resolver.hpp"
+#include "rive/mapped_file.hpp"
 #include "rive/assets/file_asset.hpp"
 #include <cstdio>
 #include <string>
@@ -10,6 +11,7 @@ namespace rive
 {
 class FileAsset;
 class Factory;
+class Executor;
 
 /// An implementation of FileAssetResolver which finds the assets in a local
 /// path relative to the original .riv file looking for them.
@@ -33,18 +35,30 @@ public:
     void loadContents(FileAsset& asset) override
     {
         std::string filename = m_Path + asset.uniqueFilename();
-        FILE* fp = fopen(filename.c_str(), "rb");
-
-        fseek(fp, 0, SEEK_END);
-        const size_t length = ftell(fp);
-        fseek(fp, 0, SEEK_SET);
-        uint8_t* bytes = new uint8_t[length];
-        if (fread(bytes, 1, length, fp) == length)
+        auto file = MappedFile::open(filename.c_str());
+        if (file != nullptr)
         {
-            asset.decode(Span<const uint8_t>(bytes, length), m_Factory);
+            asset.decode(file->bytes(), m_Factory);
         }
-        delete[] bytes;
     }
 };
+
+/// An implementation of AsyncFileAssetResolver which finds the assets in a
+/// local path relative to the original .riv file, mapping and decoding each
+/// one on an Executor.
+class AsyncRelativeLocalAssetResolver : public AsyncFileAssetResolver
+{
+private:
+    std::string m_Path;
+    Factory* m_Factory;
+    Executor* m_Executor;
+
+public:
+    /// The factory's decodeImage and decodeFont must be safe to call from
+    /// the executor's threads.
+    AsyncRelativeLocalAssetResolver(std::string filename, Factory* factory, Executor* executor);
+
+    void loadContents(std::vector<FileAsset*> assets, std::function<void()> done) override;
+};
 } // namespace rive
 #endif
@@ -4,6 +4,8 @@
 #include "rive/animation/loop.hpp"
 #include "rive/math/aabb.hpp"
 #include "rive/math/vec2d.hpp"
+#include "rive/allocator.hpp"
+#include "rive/string_view.hpp"
 #include <string>
 
 namespace rive
@@ -20,13 +22,18 @@ class Scene
 {
 protected:
     ArtboardInstance* m_ArtboardInstance;
+    /// Runtime state of the scene is allocated from its artboard instance's
+    /// allocator, hold a reference so it outlives that state.
+    rcp<Allocator> m_Allocator;
 
     Scene(ArtboardInstance*);
 
 public:
     virtual ~Scene() {}
 
-    Scene(Scene const& lhs) : m_ArtboardInstance(lhs.m_ArtboardInstance) {}
+    Scene(Scene const& lhs) :
+        m_ArtboardInstance(lhs.m_ArtboardInstance), m_Allocator(lhs.m_Allocator)
+    {}
 
     float width() const;
     float height() const;
@@ -52,9 +59,26 @@ public:
 
     virtual size_t inputCount() const;
     virtual SMIInput* input(size_t index) const;
-    virtual SMIBool* getBool(const std::string&) const;
-    virtual SMINumber* getNumber(const std::string&) const;
-    virtual SMITrigger* getTrigger(const std::string&) const;
+    virtual SMIBool* getBool(StringView) const;
+    virtual SMINumber* getNumber(StringView) const;
+    virtual SMITrigger* getTrigger(StringView) const;
+
+    // Forward to the StringView lookups above, which scenes override.
+    SMIBool* getBool(const std::string& name) const { return getBool(StringView(name)); }
+    SMINumber* getNumber(const std::string& name) const { return getNumber(StringView(name)); }
+    SMITrigger* getTrigger(const std::string& name) const { return getTrigger(StringView(name)); }
+    template <typename C> SMIBool* getBool(const C* name) const
+    {
+        return getBool(StringView(name));
+    }
+    template <typename C> SMINumber* getNumber(const C* name) const
+    {
+        return getNumber(StringView(name));
+    }
+    template <typename C> SMITrigger* getTrigger(const C* name) const
+    {
+        return getTrigger(StringView(name));
+    }
 };
 
 } // namespace rive
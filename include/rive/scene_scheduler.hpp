@@ -0,0 +1,44 @@
+#ifndef _RIVE_SCENE_SCHEDULER_HPP_
+#define _RIVE_SCENE_SCHEDULER_HPP_
+
+#include "rive/span.hpp"
+#include <memory>
+#include <vector>
+
+namespace rive
+{
+class Scene;
+class WorkerPool;
+
+/// Advances groups of independent scenes across several threads.
+///
+/// Each thread starts on its own share of a group and, once it's done,
+/// steals half of what's left of another thread's share, so a few scenes
+/// that are slow to advance don't hold up the rest.
+///
+/// Scenes in a group must each be on their own ArtboardInstance (an
+/// instance and its scenes are only ever used by one thread at a time) and
+/// must not be used elsewhere while the group advances. Scenes made from
+/// the same File can advance together. The File's Factory must be safe to
+/// call from several threads, as updating an artboard can make render paths.
+class SceneScheduler
+{
+private:
+    std::unique_ptr<WorkerPool> m_Pool;
+    size_t m_ThreadCount;
+
+public:
+    /// Advances groups on threadCount threads, counting the one calling
+    /// advance, or one per hardware thread when it's 0.
+    explicit SceneScheduler(size_t threadCount = 0);
+    ~SceneScheduler();
+
+    size_t threadCount() const { return m_ThreadCount; }
+
+    /// Calls advanceAndApply(elapsedSeconds) on every scene, returning when
+    /// they're all done. Returns the scenes that still need advancing (for
+    /// which advanceAndApply returned true), in the order they're in scenes.
+    std::vector<Scene*> advance(Span<Scene* const> scenes, float elapsedSeconds);
+};
+} // namespace rive
+#endif
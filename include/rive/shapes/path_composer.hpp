@@ -13,6 +13,7 @@ private:
     std::unique_ptr<CommandPath> m_LocalPath;
     std::unique_ptr<CommandPath> m_WorldPath;
     bool m_deferredPathDirt;
+    uint32_t m_Version = 0;
 
 public:
     PathComposer(Shape* shape);
@@ -23,6 +24,10 @@ public:
 
     CommandPath* localPath() const { return m_LocalPath.get(); }
     CommandPath* worldPath() const { return m_WorldPath.get(); }
+
+    /// Incremented each time the shape's paths change (their geometry or
+    /// their transforms), once they're up to date.
+    uint32_t version() const { return m_Version; }
 };
 } // namespace rive
 #endif
@@ -5,13 +5,14 @@
 #include "rive/generated/shapes/shape_base.hpp"
 #include "rive/shapes/path_composer.hpp"
 #include "rive/shapes/shape_paint_container.hpp"
+#include <memory>
 #include <vector>
 
 namespace rive
 {
 class Path;
 class PathComposer;
-class HitTester;
+class HitTestCommandPath;
 class Shape : public ShapeBase, public ShapePaintContainer
 {
 private:
@@ -20,10 +21,17 @@ private:
 
     bool m_WantDifferencePath = false;
 
+    /// Made the first time the shape is hit tested and reused after that, so
+    /// the winding buffer of areas too large to test inline is only
+    /// allocated once.
+    mutable std::unique_ptr<HitTestCommandPath> m_HitTester;
+    HitTestCommandPath& hitTester(const IAABB& area) const;
+
     Artboard* getArtboard() override { return artboard(); }
 
 public:
     Shape();
+    ~Shape() override;
     void buildDependencies() override;
     bool collapse(bool value) override;
     bool canDeferPathUpdate();
@@ -38,6 +46,11 @@ public:
     Core* hitTest(HitInfo*, const Mat2D&) override;
     bool hitTest(const IAABB& area) const;
 
+    /// Bounds of the paths' control points in world space, contains
+    /// everything hitTest(area) can hit. Empty (min > max) when the shape
+    /// has no paths.
+    AABB computeWorldBounds() const;
+
     const PathComposer* pathComposer() const { return &m_PathComposer; }
     PathComposer* pathComposer() { return &m_PathComposer; }
 
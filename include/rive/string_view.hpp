@@ -0,0 +1,57 @@
+/*
+ * Copyright 2022 Rive
+ */
+
+#ifndef _RIVE_STRING_VIEW_HPP_
+#define _RIVE_STRING_VIEW_HPP_
+
+#include "rive/rive_types.hpp"
+
+#include <string>
+
+/*
+ *  StringView : cheap impl of std::string_view (which is C++17)
+ *
+ *  Lets lookups by name take a std::string or a string literal without
+ *  allocating a std::string for it.
+ */
+
+namespace rive
+{
+
+class StringView
+{
+    const char* m_Ptr;
+    size_t m_Size;
+
+public:
+    StringView() : m_Ptr(""), m_Size(0) {}
+    StringView(const char* ptr, size_t size) : m_Ptr(ptr), m_Size(size) {}
+    StringView(const char* str) : m_Ptr(str), m_Size(strlen(str)) {}
+    StringView(const std::string& str) : m_Ptr(str.data()), m_Size(str.size()) {}
+
+    const char& operator[](size_t index) const
+    {
+        assert(index < m_Size);
+        return m_Ptr[index];
+    }
+
+    const char* data() const { return m_Ptr; }
+    size_t size() const { return m_Size; }
+    bool empty() const { return m_Size == 0; }
+
+    const char* begin() const { return m_Ptr; }
+    const char* end() const { return m_Ptr + m_Size; }
+
+    std::string str() const { return std::string(m_Ptr, m_Size); }
+
+    friend bool operator==(StringView a, StringView b)
+    {
+        return a.m_Size == b.m_Size && memcmp(a.m_Ptr, b.m_Ptr, a.m_Size) == 0;
+    }
+    friend bool operator!=(StringView a, StringView b) { return !(a == b); }
+};
+
+} // namespace rive
+
+#endif
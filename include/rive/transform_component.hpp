@@ -7,8 +7,11 @@ namespace rive
 {
 class Constraint;
 class WorldTransformComponent;
+class WorldTransformPass;
 class TransformComponent : public TransformComponentBase
 {
+    friend class WorldTransformPass;
+
 private:
     Mat2D m_Transform;
     float m_RenderOpacity = 0.0f;
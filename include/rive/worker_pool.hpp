@@ -0,0 +1,48 @@
+#ifndef _RIVE_WORKER_POOL_HPP_
+#define _RIVE_WORKER_POOL_HPP_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace rive
+{
+/// Runs jobs handed to it by the runtime, like decoding a file's assets.
+/// Implement it to run them on an existing thread pool or task system.
+class Executor
+{
+public:
+    virtual ~Executor() {}
+
+    /// Runs job once, at some point, on any thread.
+    virtual void execute(std::function<void()> job) = 0;
+};
+
+/// An Executor running jobs in the order they're handed to it on a fixed
+/// number of threads.
+class WorkerPool : public Executor
+{
+private:
+    std::vector<std::thread> m_Threads;
+    std::deque<std::function<void()>> m_Jobs;
+    std::mutex m_Mutex;
+    std::condition_variable m_JobAdded;
+    bool m_Stopping = false;
+
+    void work();
+
+public:
+    /// Starts threadCount threads, or one per hardware thread when it's 0.
+    explicit WorkerPool(size_t threadCount = 0);
+    /// Runs the jobs still waiting then stops the threads.
+    ~WorkerPool() override;
+
+    size_t threadCount() const { return m_Threads.size(); }
+
+    void execute(std::function<void()> job) override;
+};
+} // namespace rive
+#endif
@@ -0,0 +1,88 @@
+#ifndef _RIVE_WORLD_TRANSFORM_PASS_HPP_
+#define _RIVE_WORLD_TRANSFORM_PASS_HPP_
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace rive
+{
+class Component;
+class TransformComponent;
+class WorldTransformComponent;
+
+/// Computes the local and world transforms of an artboard's transform
+/// components a hierarchy level at a time, several components at once,
+/// ahead of the rest of the artboard's component updates.
+///
+/// Only components whose world transform depends solely on their own and
+/// their ancestors' local transforms take part: anything constrained (or
+/// in an IK chain), and anything below it, is left to the regular
+/// dependency ordered update so constraints still run after the transforms
+/// they read.
+class WorldTransformPass
+{
+public:
+    /// Picks the components that can be batched out of an artboard's
+    /// components in dependency order.
+    void build(const std::vector<Component*>& dependencyOrder);
+
+    /// Queues the component at graphOrder, if it's batched, for the next
+    /// update. The artboard calls this when Transform or WorldTransform dirt
+    /// is added to a component.
+    void markDirty(uint32_t graphOrder)
+    {
+        if (graphOrder >= m_Indices.size())
+        {
+            return;
+        }
+        int32_t index = m_Indices[graphOrder];
+        if (index == -1 || m_Queued[index])
+        {
+            return;
+        }
+        m_Queued[index] = true;
+        m_Pending[m_Levels[index]].push_back((uint32_t)index);
+        m_PendingCount++;
+    }
+
+    /// Updates the transforms of the queued components that still have
+    /// Transform or WorldTransform dirt, clearing those bits so their
+    /// update() skips them. Other dirt is left for their update().
+    /// dirtyComponents is the artboard's dirty bit per graph order, it's
+    /// cleared for those left with no dirt. Returns right away when nothing
+    /// is queued, and otherwise only visits the queued components. Returns
+    /// whether any component was updated.
+    bool update(std::vector<uint64_t>& dirtyComponents);
+
+    size_t count() const { return m_Components.size(); }
+    size_t levelCount() const { return m_LevelEnds.size(); }
+    /// Number of components queued for the next update.
+    size_t pendingCount() const { return m_PendingCount; }
+
+private:
+    // Batched components grouped by depth: level i spans
+    // [m_LevelEnds[i - 1], m_LevelEnds[i]).
+    std::vector<TransformComponent*> m_Components;
+    std::vector<uint32_t> m_GraphOrders;
+    // Each component's parent world transform, nullptr for identity.
+    std::vector<const WorldTransformComponent*> m_Parents;
+    std::vector<uint32_t> m_LevelEnds;
+    // Each component's level and its index (or -1) per graph order.
+    std::vector<uint32_t> m_Levels;
+    std::vector<int32_t> m_Indices;
+
+    // Components queued by markDirty, by level.
+    std::vector<std::vector<uint32_t>> m_Pending;
+    std::vector<bool> m_Queued;
+    size_t m_PendingCount = 0;
+
+    // Scratch lanes for the dirty components of the level being updated,
+    // padded to a multiple of 4: the rotation (cos, sin, -sin, cos) or
+    // current local matrix's first four values, scale, translation and the
+    // parent's world transform in, local and world transform out.
+    std::vector<uint32_t> m_Dirty;
+    std::vector<float> m_Lanes;
+};
+} // namespace rive
+
+#endif
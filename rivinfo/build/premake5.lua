@@ -43,7 +43,6 @@ project "rivinfo"
 
     files {
         "../**.cpp",
-        "../../utils/no_op_factory.cpp",
     }
 
     buildoptions {"-Wall", "-fno-rtti", "-g"}
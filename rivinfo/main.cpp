@@ -2,12 +2,9 @@
  * Copyright 2022 Rive
  */
 
-#include "rive/artboard.hpp"
-#include "rive/file.hpp"
-#include "rive/animation/linear_animation_instance.hpp"
-#include "rive/animation/state_machine_instance.hpp"
-#include "rive/animation/state_machine_input_instance.hpp"
-#include "utils/no_op_factory.hpp"
+#include "rive/file_metadata.hpp"
+#include <cstdio>
+#include <cstring>
 
 class JSoner
 {
@@ -73,74 +70,72 @@ public:
 
 //////////////////////////////////////////////////
 
-static void dump(JSoner& js, rive::LinearAnimationInstance* anim)
+static void dump(JSoner& js, const rive::LinearAnimationMetadata& anim)
 {
     js.pushStruct();
-    js.add("name", anim->name().c_str());
-    js.add("duration", std::to_string(anim->durationSeconds()).c_str());
-    js.add("loop", std::to_string(anim->loopValue()).c_str());
+    js.add("name", anim.name.c_str());
+    js.add("duration", std::to_string(anim.durationSeconds()).c_str());
+    js.add("loop", std::to_string(anim.loopValue).c_str());
     js.pop();
 }
 
-static void dump(JSoner& js, rive::StateMachineInstance* smi)
+static void dump(JSoner& js, const rive::StateMachineMetadata& sm)
 {
     js.pushStruct();
-    js.add("name", smi->name().c_str());
-    if (auto count = smi->inputCount())
+    js.add("name", sm.name.c_str());
+    if (auto count = sm.inputs.size())
     {
         js.pushArray("inputs");
-        for (auto i = 0; i < count; ++i)
+        for (size_t i = 0; i < count; ++i)
         {
-            auto inp = smi->input(i);
-            js.add("name", inp->name().c_str());
+            js.add("name", sm.inputs[i].name.c_str());
         }
         js.pop();
     }
     js.pop();
 }
 
-static void dump(JSoner& js, rive::ArtboardInstance* abi)
+static void dump(JSoner& js, const rive::ArtboardMetadata& ab)
 {
     js.pushStruct();
-    js.add("name", abi->name().c_str());
-    if (auto count = abi->animationCount())
+    js.add("name", ab.name.c_str());
+    if (auto count = ab.animations.size())
     {
         js.pushArray("animations");
         for (size_t i = 0; i < count; ++i)
         {
-            dump(js, abi->animationAt(i).get());
+            dump(js, ab.animations[i]);
         }
         js.pop();
     }
-    if (auto count = abi->stateMachineCount())
+    if (auto count = ab.stateMachines.size())
     {
         js.pushArray("machines");
         for (size_t i = 0; i < count; ++i)
         {
-            dump(js, abi->stateMachineAt(i).get());
+            dump(js, ab.stateMachines[i]);
         }
         js.pop();
     }
     js.pop();
 }
 
-static void dump(JSoner& js, rive::File* file)
+static void dump(JSoner& js, const rive::FileMetadata& file)
 {
-    auto count = file->artboardCount();
     js.pushArray("artboards");
-    for (size_t i = 0; i < count; ++i)
+    for (auto& ab : file.artboards)
     {
-        dump(js, file->artboardAt(i).get());
+        dump(js, ab);
     }
     js.pop();
 }
 
-static std::unique_ptr<rive::File> open_file(const char name[])
+static bool scan_file(const char name[], rive::FileMetadata* metadata)
 {
     FILE* f = fopen(name, "rb");
     if (!f)
     {
-        return nullptr;
+        return false;
     }
 
     fseek(f, 0, SEEK_END);
@@ -152,11 +147,13 @@ static std::unique_ptr<rive::File> open_file(const char name[])
     if (fread(bytes.data(), 1, length, f) != length)
     {
         printf("Failed to read file into bytes array\n");
-        return nullptr;
+        fclose(f);
+        return false;
     }
+    fclose(f);
 
-    static rive::NoOpFactory gFactory;
-    return rive::File::import(bytes, &gFactory);
+    // Only the metadata is needed, so skip importing the whole file.
+    return rive::FileMetadata::scan(bytes, metadata) == rive::ImportResult::success;
 }
 
 static bool is_arg(const char arg[], const char target[], const char alt[] = nullptr)
@@ -185,8 +182,8 @@ int main(int argc, const char* argv[])
         return 1;
     }
 
-    auto file = open_file(filename);
-    if (!file)
+    rive::FileMetadata metadata;
+    if (!scan_file(filename, &metadata))
     {
         printf("Can't open %s\n", filename);
         return 1;
@@ -194,6 +191,6 @@ int main(int argc, const char* argv[])
 
     JSoner js;
     js.pushStruct();
-    dump(js, file.get());
+    dump(js, metadata);
     return 0;
 }
@@ -0,0 +1,154 @@
+/*
+ * Copyright 2022 Rive
+ */
+
+#include "rive/allocator.hpp"
+#include "rive/core.hpp"
+
+#include <algorithm>
+#include <new>
+
+using namespace rive;
+
+static thread_local Allocator* sCurrentAllocator = nullptr;
+
+Allocator* Allocator::current() { return sCurrentAllocator; }
+
+AllocatorScope::AllocatorScope(Allocator* allocator) : m_Previous(sCurrentAllocator)
+{
+    sCurrentAllocator = allocator;
+}
+
+AllocatorScope::~AllocatorScope() { sCurrentAllocator = m_Previous; }
+
+static const size_t kAlignment = alignof(std::max_align_t);
+static const size_t kMaxChunkSize = 256 * 1024;
+// Anything larger comes straight from the heap.
+static const size_t kMaxArenaAllocation = 2 * 1024;
+
+static inline size_t alignSize(size_t size, size_t alignment)
+{
+    return (size + alignment - 1) & ~(alignment - 1);
+}
+
+ArenaAllocator::ArenaAllocator(size_t initialChunkSize) : m_NextChunkSize(initialChunkSize) {}
+
+ArenaAllocator::~ArenaAllocator()
+{
+    for (auto chunk : m_Chunks)
+    {
+        ::operator delete(chunk);
+    }
+}
+
+void* ArenaAllocator::allocate(size_t size)
+{
+    size = alignSize(size, kAlignment);
+    if (size > kMaxArenaAllocation)
+    {
+        return ::operator new(size);
+    }
+
+    size_t bucket = size / kAlignment;
+    if (bucket < m_FreeBlocks.size() && m_FreeBlocks[bucket] != nullptr)
+    {
+        void* block = m_FreeBlocks[bucket];
+        m_FreeBlocks[bucket] = *static_cast<void**>(block);
+        return block;
+    }
+
+    if ((size_t)(m_End - m_Cursor) < size)
+    {
+        // Whatever is left in the current chunk is wasted, chunks grow so
+        // that's a small fraction of the total.
+        size_t chunkSize = std::max(m_NextChunkSize, size);
+        m_NextChunkSize = std::min(m_NextChunkSize * 2, kMaxChunkSize);
+        m_Cursor = static_cast<char*>(::operator new(chunkSize));
+        m_End = m_Cursor + chunkSize;
+        m_Chunks.push_back(m_Cursor);
+    }
+    void* block = m_Cursor;
+    m_Cursor += size;
+    return block;
+}
+
+void ArenaAllocator::deallocate(void* ptr, size_t size)
+{
+    size = alignSize(size, kAlignment);
+    if (size > kMaxArenaAllocation)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    size_t bucket = size / kAlignment;
+    if (bucket >= m_FreeBlocks.size())
+    {
+        m_FreeBlocks.resize(bucket + 1, nullptr);
+    }
+    *static_cast<void**>(ptr) = m_FreeBlocks[bucket];
+    m_FreeBlocks[bucket] = ptr;
+}
+
+// Every Allocated object is prefixed with the allocator it came from (nullptr
+// for the heap), padded to keep the object itself aligned.
+static const size_t kHeaderSize = kAlignment;
+static_assert(kHeaderSize >= sizeof(Allocator*), "header must fit an Allocator pointer");
+
+static void* allocateWithHeader(size_t size)
+{
+    Allocator* allocator = sCurrentAllocator;
+    size += kHeaderSize;
+    char* block = static_cast<char*>(allocator != nullptr ? allocator->allocate(size)
+                                                          : ::operator new(size));
+    *reinterpret_cast<Allocator**>(block) = allocator;
+    return block + kHeaderSize;
+}
+
+static void deallocateWithHeader(void* ptr, size_t size)
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+    char* block = static_cast<char*>(ptr) - kHeaderSize;
+    Allocator* allocator = *reinterpret_cast<Allocator**>(block);
+    if (allocator != nullptr)
+    {
+        allocator->deallocate(block, size + kHeaderSize);
+    }
+    else
+    {
+        ::operator delete(block);
+    }
+}
+
+void* Allocated::operator new(size_t size) { return allocateWithHeader(size); }
+
+void Allocated::operator delete(void* ptr, size_t size) { deallocateWithHeader(ptr, size); }
+
+void* Allocated::operator new[](size_t size) { return allocateWithHeader(size); }
+
+void Allocated::operator delete[](void* ptr, size_t size) { deallocateWithHeader(ptr, size); }
+
+void* Core::operator new(size_t size)
+{
+    Allocator* allocator = sCurrentAllocator;
+    return allocator != nullptr ? allocator->allocate(size) : ::operator new(size);
+}
+
+void Core::operator delete(void* ptr, size_t size)
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+    if (Allocator* allocator = sCurrentAllocator)
+    {
+        allocator->deallocate(ptr, size);
+    }
+    else
+    {
+        ::operator delete(ptr);
+    }
+}
@@ -28,7 +28,16 @@ void AnimationStateInstance::advance(float seconds, Span<SMIInput*>)
     m_KeepGoing = m_AnimationInstance.advance(seconds * state()->as<AnimationState>()->speed());
 }
 
-void AnimationStateInstance::apply(float mix) { m_AnimationInstance.apply(mix); }
+void AnimationStateInstance::apply(float mix, PoseBuffer* pose)
+{
+    m_AnimationInstance.apply(mix, pose);
+}
 
 bool AnimationStateInstance::keepGoing() const { return m_KeepGoing; }
-void AnimationStateInstance::clearSpilledTime() { m_AnimationInstance.clearSpilledTime(); }
\ No newline at end of file
+void AnimationStateInstance::clearSpilledTime() { m_AnimationInstance.clearSpilledTime(); }
+
+void AnimationStateInstance::reset()
+{
+    m_AnimationInstance.resetForReuse(state()->as<AnimationState>()->speed());
+    m_KeepGoing = true;
+}
\ No newline at end of file
@@ -8,6 +8,13 @@ BlendState1DInstance::BlendState1DInstance(const BlendState1D* blendState,
     BlendStateInstance<BlendState1D, BlendAnimation1D>(blendState, instance)
 {}
 
+void BlendState1DInstance::reset()
+{
+    BlendStateInstance<BlendState1D, BlendAnimation1D>::reset();
+    m_From = nullptr;
+    m_To = nullptr;
+}
+
 int BlendState1DInstance::animationIndex(float value)
 {
     int idx = 0;
@@ -1,4 +1,6 @@
 #include "rive/animation/cubic_ease_interpolator.hpp"
+#include "rive/math/simd.hpp"
+#include <algorithm>
 
 using namespace rive;
 
@@ -10,4 +12,43 @@ float CubicEaseInterpolator::transformValue(float valueFrom, float valueTo, floa
 float CubicEaseInterpolator::transform(float factor) const
 {
     return calcBezier(getT(factor), y1(), y2());
+}
+
+void CubicEaseInterpolator::transform(const CubicEaseInterpolator* const* interpolators,
+                                      const float* factors,
+                                      float* results,
+                                      size_t count)
+{
+    const size_t chunkSize = 32;
+    const CubicInterpolator* chunk[chunkSize];
+    for (size_t start = 0; start < count; start += chunkSize)
+    {
+        size_t chunkCount = std::min(count - start, chunkSize);
+        std::copy(interpolators + start, interpolators + start + chunkCount, chunk);
+        // Solve for t in place, then evaluate y(t).
+        float* t = results + start;
+        getT(chunk, factors + start, t, chunkCount);
+
+        size_t i = 0;
+        for (; i + 4 <= chunkCount; i += 4)
+        {
+            float b1[4], b2[4];
+            for (int lane = 0; lane < 4; lane++)
+            {
+                b1[lane] = chunk[i + lane]->y1();
+                b2[lane] = chunk[i + lane]->y2();
+            }
+            float4 y1 = simd::load4f(b1);
+            float4 y2 = simd::load4f(b2);
+            float4 x = simd::load4f(t + i);
+            float4 y =
+                (((1.0f - 3.0f * y2 + 3.0f * y1) * x + (3.0f * y2 - 6.0f * y1)) * x + (3.0f * y1)) *
+                x;
+            simd::store(t + i, y);
+        }
+        for (; i < chunkCount; i++)
+        {
+            t[i] = calcBezier(t[i], chunk[i]->y1(), chunk[i]->y2());
+        }
+    }
 }
\ No newline at end of file
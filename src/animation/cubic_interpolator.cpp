@@ -2,6 +2,9 @@
 #include "rive/artboard.hpp"
 #include "rive/importers/artboard_importer.hpp"
 #include "rive/importers/import_stack.hpp"
+#include "rive/math/simd.hpp"
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 
 using namespace rive;
@@ -11,6 +14,15 @@ const float NewtonMinSlope = 0.001f;
 const float SubdivisionPrecision = 0.0000001f;
 const int SubdivisionMaxIterations = 10;
 
+static std::atomic<bool> sInverseTablesEnabled(false);
+
+void CubicInterpolator::enableInverseTables(bool value) { sInverseTablesEnabled = value; }
+
+bool CubicInterpolator::inverseTablesEnabled()
+{
+    return sInverseTablesEnabled.load(std::memory_order_relaxed);
+}
+
 // Returns x(t) given t, x1, and x2, or y(t) given t, y1, and y2.
 float CubicInterpolator::calcBezier(float aT, float aA1, float aA2)
 {
@@ -32,10 +44,112 @@ StatusCode CubicInterpolator::onAddedDirty(CoreContext* context)
     {
         m_Values[i] = calcBezier(i * SampleStepSize, x1(), x2());
     }
+    if (inverseTablesEnabled())
+    {
+        buildInverseTable();
+    }
+    else
+    {
+        m_HasInverseTable = false;
+    }
     return StatusCode::Ok;
 }
 
+void CubicInterpolator::buildInverseTable()
+{
+    m_HasInverseTable = false;
+    for (int i = 0; i <= InverseTableSize; ++i)
+    {
+        m_InverseT[i] = solveT(i / (float)InverseTableSize);
+    }
+    for (int i = 0; i < InverseTableSize; ++i)
+    {
+        for (int j = 1; j < 4; ++j)
+        {
+            float x = (i + j / 4.0f) / InverseTableSize;
+            // Leave headroom for the points in between that aren't checked.
+            if (std::abs(lookupT(x) - solveT(x)) > InverseTableMaxError * 0.5f)
+            {
+                return;
+            }
+        }
+    }
+    m_HasInverseTable = true;
+}
+
+float CubicInterpolator::lookupT(float x) const
+{
+    float position = x * InverseTableSize;
+    int index = std::min(std::max((int)position, 0), InverseTableSize - 1);
+    float t = m_InverseT[index] + (m_InverseT[index + 1] - m_InverseT[index]) * (position - index);
+
+    float _x1 = x1(), _x2 = x2();
+    float slope = getSlope(t, _x1, _x2);
+    if (slope >= NewtonMinSlope)
+    {
+        t -= (calcBezier(t, _x1, _x2) - x) / slope;
+    }
+    return t;
+}
+
 float CubicInterpolator::getT(float x) const
+{
+    return m_HasInverseTable ? lookupT(x) : solveT(x);
+}
+
+void CubicInterpolator::getT(const CubicInterpolator* const* interpolators,
+                             const float* x,
+                             float* t,
+                             size_t count)
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        // Gather the table samples on each side of x, lanes without a table
+        // get the solved t on both sides and skip the Newton step.
+        float from[4], to[4], fraction[4], a1[4], a2[4];
+        int32_t refine[4];
+        for (int lane = 0; lane < 4; lane++)
+        {
+            const CubicInterpolator* interpolator = interpolators[i + lane];
+            a1[lane] = interpolator->x1();
+            a2[lane] = interpolator->x2();
+            if (interpolator->m_HasInverseTable)
+            {
+                float position = x[i + lane] * InverseTableSize;
+                int index = std::min(std::max((int)position, 0), InverseTableSize - 1);
+                from[lane] = interpolator->m_InverseT[index];
+                to[lane] = interpolator->m_InverseT[index + 1];
+                fraction[lane] = position - index;
+                refine[lane] = ~0;
+            }
+            else
+            {
+                from[lane] = to[lane] = interpolator->solveT(x[i + lane]);
+                fraction[lane] = 0.0f;
+                refine[lane] = 0;
+            }
+        }
+
+        float4 guess = simd::load4f(from);
+        guess += (simd::load4f(to) - guess) * simd::load4f(fraction);
+        float4 x1 = simd::load4f(a1);
+        float4 x2 = simd::load4f(a2);
+        float4 a = 1.0f - 3.0f * x2 + 3.0f * x1;
+        float4 b = 3.0f * x2 - 6.0f * x1;
+        float4 c = 3.0f * x1;
+        float4 slope = 3.0f * a * guess * guess + 2.0f * b * guess + c;
+        float4 currentX = ((a * guess + b) * guess + c) * guess - simd::load4f(x + i);
+        int4 useNewton = simd::load4i(refine) & (slope >= NewtonMinSlope);
+        simd::store(t + i, simd::if_then_else(useNewton, guess - currentX / slope, guess));
+    }
+    for (; i < count; i++)
+    {
+        t[i] = interpolators[i]->getT(x[i]);
+    }
+}
+
+float CubicInterpolator::solveT(float x) const
 {
     float intervalStart = 0.0f;
     int currentSample = 1;
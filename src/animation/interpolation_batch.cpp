@@ -0,0 +1,95 @@
+#include "rive/animation/interpolation_batch.hpp"
+#include "rive/animation/cubic_ease_interpolator.hpp"
+#include "rive/animation/pose_buffer.hpp"
+#include "rive/math/simd.hpp"
+
+using namespace rive;
+
+void InterpolationBatch::flush()
+{
+    if (m_Count == 0)
+    {
+        return;
+    }
+
+    // Ease the factors that need it all together.
+    const CubicEaseInterpolator* easings[kCapacity];
+    float factors[kCapacity];
+    int indices[kCapacity];
+    int easedCount = 0;
+    for (int i = 0; i < m_Count; i++)
+    {
+        if (m_Easings[i] != nullptr)
+        {
+            easings[easedCount] = m_Easings[i];
+            factors[easedCount] = m_Factors[i];
+            indices[easedCount++] = i;
+        }
+    }
+    if (easedCount != 0)
+    {
+        CubicEaseInterpolator::transform(easings, factors, factors, easedCount);
+        for (int i = 0; i < easedCount; i++)
+        {
+            m_Factors[indices[i]] = factors[i];
+        }
+    }
+
+    // Pad to a multiple of 4 with entries that interpolate to 0, they're
+    // never written.
+    int count = m_Count;
+    for (int i = count; i < ((count + 3) & ~3); i++)
+    {
+        m_From[i] = m_To[i] = m_Factors[i] = 0.0f;
+    }
+
+    float values[kCapacity];
+    if (m_Mix == 1.0f || m_Pose != nullptr)
+    {
+        for (int i = 0; i < count; i += 4)
+        {
+            float4 from = simd::load4f(m_From + i);
+            float4 to = simd::load4f(m_To + i);
+            float4 factor = simd::load4f(m_Factors + i);
+            simd::store(values + i, from + (to - from) * factor);
+        }
+    }
+    else
+    {
+        float current[kCapacity];
+        for (int i = 0; i < count; i++)
+        {
+            current[i] = m_Accessors[i]->getDouble(m_Objects[i]);
+        }
+        for (int i = count; i < ((count + 3) & ~3); i++)
+        {
+            current[i] = 0.0f;
+        }
+        float mix = m_Mix;
+        float mixi = 1.0f - mix;
+        for (int i = 0; i < count; i += 4)
+        {
+            float4 from = simd::load4f(m_From + i);
+            float4 to = simd::load4f(m_To + i);
+            float4 factor = simd::load4f(m_Factors + i);
+            float4 value = from + (to - from) * factor;
+            simd::store(values + i, simd::load4f(current + i) * mixi + value * mix);
+        }
+    }
+
+    if (m_Pose != nullptr)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            m_Pose->accumulate(m_Objects[i], *m_Accessors[i], values[i], m_Mix);
+        }
+    }
+    else
+    {
+        for (int i = 0; i < count; i++)
+        {
+            m_Accessors[i]->setDouble(m_Objects[i], values[i]);
+        }
+    }
+    m_Count = 0;
+}
@@ -42,16 +42,50 @@ StatusCode KeyedObject::onAddedClean(CoreContext* context)
     return StatusCode::Ok;
 }
 
-void KeyedObject::apply(Artboard* artboard, float time, float mix)
+void KeyedObject::apply(Artboard* artboard,
+                        float time,
+                        float mix,
+                        uint32_t* cursors,
+                        InterpolationBatch* batch)
 {
     Core* object = artboard->resolve(objectId());
     if (object == nullptr)
     {
         return;
     }
+    apply(object, time, mix, cursors, batch);
+}
+
+void KeyedObject::apply(Core* object,
+                        float time,
+                        float mix,
+                        uint32_t* cursors,
+                        InterpolationBatch* batch)
+{
     for (auto& property : m_KeyedProperties)
     {
-        property->apply(object, time, mix);
+        property->apply(object, time, mix, cursors, batch);
+        if (cursors != nullptr)
+        {
+            cursors++;
+        }
+    }
+}
+
+void KeyedObject::applyBatch(const AnimationSampleGroup& group,
+                             Core* const* objects,
+                             uint32_t** cursors)
+{
+    for (auto& property : m_KeyedProperties)
+    {
+        property->applyBatch(group, objects, cursors);
+        for (size_t i = 0; i < group.count; i++)
+        {
+            if (cursors[i] != nullptr)
+            {
+                cursors[i]++;
+            }
+        }
     }
 }
 
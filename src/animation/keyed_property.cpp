@@ -1,8 +1,19 @@
 #include "rive/animation/keyed_property.hpp"
+#include "rive/animation/cubic_ease_interpolator.hpp"
+#include "rive/animation/interpolation_batch.hpp"
 #include "rive/animation/keyed_object.hpp"
 #include "rive/animation/keyframe.hpp"
+#include "rive/animation/keyframe_color.hpp"
+#include "rive/animation/keyframe_double.hpp"
+#include "rive/animation/linear_animation.hpp"
+#include "rive/animation/pose_buffer.hpp"
+#include "rive/generated/core_registry.hpp"
 #include "rive/importers/import_stack.hpp"
 #include "rive/importers/keyed_object_importer.hpp"
+#include "rive/math/simd.hpp"
+#include "rive/shapes/paint/color.hpp"
+#include <algorithm>
+#include <cstdio>
 
 using namespace rive;
 
@@ -14,20 +25,18 @@ void KeyedProperty::addKeyFrame(std::unique_ptr<KeyFrame> keyframe)
     m_KeyFrames.push_back(std::move(keyframe));
 }
 
-void KeyedProperty::apply(Core* object, float seconds, float mix)
+int KeyedProperty::closestFrameIndex(float seconds) const
 {
-    assert(!m_KeyFrames.empty());
-
     int idx = 0;
     int mid = 0;
     float closestSeconds = 0.0f;
     int start = 0;
-    auto numKeyFrames = static_cast<int>(m_KeyFrames.size());
+    auto numKeyFrames = static_cast<int>(m_Seconds.size());
     int end = numKeyFrames - 1;
     while (start <= end)
     {
         mid = (start + end) >> 1;
-        closestSeconds = m_KeyFrames[mid]->seconds();
+        closestSeconds = m_Seconds[mid];
         if (closestSeconds < seconds)
         {
             start = mid + 1;
@@ -43,11 +52,174 @@ void KeyedProperty::apply(Core* object, float seconds, float mix)
         }
         idx = start;
     }
-    int pk = propertyKey();
+    return idx;
+}
 
+int KeyedProperty::closestFrameIndex(float seconds, int hint) const
+{
+    // How far we'll walk from the hint before giving up and searching (after
+    // a seek or loop).
+    const int maxSteps = 4;
+
+    auto numKeyFrames = static_cast<int>(m_Seconds.size());
+    int idx = std::min(hint, numKeyFrames);
+    for (int step = 0; step < maxSteps; step++)
+    {
+        if (idx < numKeyFrames && m_Seconds[idx] < seconds)
+        {
+            idx++;
+        }
+        else if (idx > 0 && m_Seconds[idx - 1] >= seconds)
+        {
+            idx--;
+        }
+        else if (idx < numKeyFrames && m_Seconds[idx] == seconds)
+        {
+            // Landing exactly on a keyframe, let the search pick which one
+            // (there can be multiple at the same time).
+            break;
+        }
+        else
+        {
+            return idx;
+        }
+    }
+    return closestFrameIndex(seconds);
+}
+
+int KeyedProperty::frameIndex(float seconds, uint32_t* cursor) const
+{
+    if (cursor == nullptr)
+    {
+        return closestFrameIndex(seconds);
+    }
+    int idx = closestFrameIndex(seconds, (int)*cursor);
+    *cursor = (uint32_t)idx;
+    return idx;
+}
+
+int KeyedProperty::heldFrameIndex(int idx, float seconds) const
+{
     if (idx == 0)
     {
-        m_KeyFrames[0]->apply(object, pk, mix);
+        return 0;
+    }
+    if (idx == static_cast<int>(m_Seconds.size()))
+    {
+        return idx - 1;
+    }
+    if (seconds == m_Seconds[idx])
+    {
+        return idx;
+    }
+    if (m_Interpolations[idx - 1] == kHold)
+    {
+        return idx - 1;
+    }
+    return -1;
+}
+
+const CubicEaseInterpolator* KeyedProperty::interpolationTerms(int idx,
+                                                               float seconds,
+                                                               float* from,
+                                                               float* to,
+                                                               float* factor) const
+{
+    int frame = heldFrameIndex(idx, seconds);
+    if (frame != -1)
+    {
+        *from = *to = m_DoubleValues[frame];
+        *factor = 0.0f;
+        return nullptr;
+    }
+    *from = m_DoubleValues[idx - 1];
+    *to = m_DoubleValues[idx];
+    *factor = (seconds - m_Seconds[idx - 1]) / (m_Seconds[idx] - m_Seconds[idx - 1]);
+    uint16_t interpolation = m_Interpolations[idx - 1];
+    if (interpolation >= kCubic)
+    {
+        CubicInterpolator* cubic = m_Interpolators[interpolation - kCubic];
+        if (cubic->is<CubicEaseInterpolator>())
+        {
+            return cubic->as<CubicEaseInterpolator>();
+        }
+        *from = *to = cubic->transformValue(*from, *to, *factor);
+        *factor = 0.0f;
+    }
+    return nullptr;
+}
+
+void KeyedProperty::applyDouble(Core* object,
+                                int idx,
+                                float seconds,
+                                float mix,
+                                InterpolationBatch* batch)
+{
+    // Computed as the terms of from + (to - from) * factor so the lerp can be
+    // batched.
+    float from, to, factor;
+    const CubicEaseInterpolator* easing = interpolationTerms(idx, seconds, &from, &to, &factor);
+    if (batch != nullptr)
+    {
+        batch->add(object, m_Accessor, from, to, factor, easing);
+        return;
+    }
+    if (easing != nullptr)
+    {
+        factor = easing->transform(factor);
+    }
+    float value = from + (to - from) * factor;
+    if (mix == 1.0f)
+    {
+        m_Accessor.setDouble(object, value);
+    }
+    else
+    {
+        float mixi = 1.0f - mix;
+        m_Accessor.setDouble(object, m_Accessor.getDouble(object) * mixi + value * mix);
+    }
+}
+
+ColorInt KeyedProperty::colorValue(int idx, float seconds) const
+{
+    int frame = heldFrameIndex(idx, seconds);
+    if (frame != -1)
+    {
+        return m_ColorValues[frame];
+    }
+    float f = (seconds - m_Seconds[idx - 1]) / (m_Seconds[idx] - m_Seconds[idx - 1]);
+    uint16_t interpolation = m_Interpolations[idx - 1];
+    if (interpolation >= kCubic)
+    {
+        f = m_Interpolators[interpolation - kCubic]->transform(f);
+    }
+    return colorLerp(m_ColorValues[idx - 1], m_ColorValues[idx], f);
+}
+
+void KeyedProperty::applyColor(Core* object, ColorInt value, float mix, PoseBuffer* pose)
+{
+    if (pose != nullptr)
+    {
+        pose->accumulateColor(object, m_Accessor, value, mix);
+    }
+    else if (mix == 1.0f)
+    {
+        m_Accessor.setColor(object, value);
+    }
+    else
+    {
+        m_Accessor.setColor(object, colorLerp(m_Accessor.getColor(object), value, mix));
+    }
+}
+
+void KeyedProperty::applyKeyFrames(Core* object, int idx, float seconds, float mix)
+{
+    auto numKeyFrames = static_cast<int>(m_KeyFrames.size());
+    const KeyFramePropertyAccessor& accessor = m_Accessor;
+
+    if (idx == 0)
+    {
+        m_KeyFrames[0]->apply(object, accessor, mix);
     }
     else
     {
@@ -57,27 +229,223 @@ void KeyedProperty::apply(Core* object, float seconds, float mix)
             KeyFrame* toFrame = m_KeyFrames[idx].get();
             if (seconds == toFrame->seconds())
             {
-                toFrame->apply(object, pk, mix);
+                toFrame->apply(object, accessor, mix);
             }
             else
             {
                 if (fromFrame->interpolationType() == 0)
                 {
-                    fromFrame->apply(object, pk, mix);
+                    fromFrame->apply(object, accessor, mix);
                 }
                 else
                 {
-                    fromFrame->applyInterpolation(object, pk, seconds, toFrame, mix);
+                    fromFrame->applyInterpolation(object, accessor, seconds, toFrame, mix);
                 }
             }
         }
         else
         {
-            m_KeyFrames[idx - 1]->apply(object, pk, mix);
+            m_KeyFrames[idx - 1]->apply(object, accessor, mix);
         }
     }
 }
 
+void KeyedProperty::apply(Core* object,
+                          float seconds,
+                          float mix,
+                          uint32_t* cursor,
+                          InterpolationBatch* batch)
+{
+    assert(!m_Seconds.empty());
+    if (!m_IsBound)
+    {
+        return;
+    }
+
+    int idx = frameIndex(seconds, cursor);
+    if (!m_DoubleValues.empty())
+    {
+        applyDouble(object, idx, seconds, mix, batch);
+        return;
+    }
+    // Anything queued before this property is written first, so properties
+    // still change (and notify their objects) in keyed order.
+    if (batch != nullptr)
+    {
+        batch->flush();
+    }
+    if (!m_ColorValues.empty())
+    {
+        applyColor(object,
+                   colorValue(idx, seconds),
+                   mix,
+                   batch != nullptr ? batch->pose() : nullptr);
+        return;
+    }
+    applyKeyFrames(object, idx, seconds, mix);
+}
+
+void KeyedProperty::applyBatch(const AnimationSampleGroup& group,
+                               Core* const* objects,
+                               uint32_t* const* cursors)
+{
+    assert(!m_Seconds.empty());
+    if (!m_IsBound)
+    {
+        return;
+    }
+
+    // Search once per distinct time. They're ascending, so each search walks
+    // forward from the last one's keyframe, and the first starts from the
+    // cursor of a sample at that time (if any has one).
+    int indices[AnimationSampleGroup::kCapacity];
+    int hint = -1;
+    for (size_t i = 0; i < group.count && hint == -1; i++)
+    {
+        if (group.timeIndices[i] == 0 && cursors[i] != nullptr)
+        {
+            hint = (int)*cursors[i];
+        }
+    }
+    for (size_t t = 0; t < group.timeCount; t++)
+    {
+        hint = hint == -1 ? closestFrameIndex(group.times[t])
+                          : closestFrameIndex(group.times[t], hint);
+        indices[t] = hint;
+    }
+    for (size_t i = 0; i < group.count; i++)
+    {
+        if (cursors[i] != nullptr)
+        {
+            *cursors[i] = (uint32_t)indices[group.timeIndices[i]];
+        }
+    }
+
+    if (!m_DoubleValues.empty())
+    {
+        applyDoubleBatch(group, objects, indices);
+        return;
+    }
+    if (!m_ColorValues.empty())
+    {
+        ColorInt values[AnimationSampleGroup::kCapacity];
+        for (size_t t = 0; t < group.timeCount; t++)
+        {
+            values[t] = colorValue(indices[t], group.times[t]);
+        }
+        for (size_t i = 0; i < group.count; i++)
+        {
+            if (objects[i] != nullptr)
+            {
+                applyColor(objects[i],
+                           values[group.timeIndices[i]],
+                           group.mixes[i],
+                           group.poses[i]);
+            }
+        }
+        return;
+    }
+    for (size_t i = 0; i < group.count; i++)
+    {
+        if (objects[i] != nullptr)
+        {
+            int t = group.timeIndices[i];
+            applyKeyFrames(objects[i], indices[t], group.times[t], group.mixes[i]);
+        }
+    }
+}
+
+void KeyedProperty::applyDoubleBatch(const AnimationSampleGroup& group,
+                                     Core* const* objects,
+                                     const int* indices)
+{
+    // Interpolate each distinct time's value, four at a time, easing the
+    // factors that need it all together. Padding lanes interpolate to 0.
+    const int kCapacity = AnimationSampleGroup::kCapacity;
+    float from[kCapacity];
+    float to[kCapacity];
+    float factors[kCapacity];
+    const CubicEaseInterpolator* easings[kCapacity];
+    float eased[kCapacity];
+    int easedTimes[kCapacity];
+    int timeCount = (int)group.timeCount;
+    int easedCount = 0;
+    for (int t = 0; t < timeCount; t++)
+    {
+        const CubicEaseInterpolator* easing =
+            interpolationTerms(indices[t], group.times[t], &from[t], &to[t], &factors[t]);
+        if (easing != nullptr)
+        {
+            easings[easedCount] = easing;
+            eased[easedCount] = factors[t];
+            easedTimes[easedCount++] = t;
+        }
+    }
+    if (easedCount != 0)
+    {
+        CubicEaseInterpolator::transform(easings, eased, eased, easedCount);
+        for (int i = 0; i < easedCount; i++)
+        {
+            factors[easedTimes[i]] = eased[i];
+        }
+    }
+    for (int t = timeCount; t < ((timeCount + 3) & ~3); t++)
+    {
+        from[t] = to[t] = factors[t] = 0.0f;
+    }
+    float timeValues[kCapacity];
+    for (int t = 0; t < timeCount; t += 4)
+    {
+        float4 from4 = simd::load4f(from + t);
+        simd::store(timeValues + t,
+                    from4 + (simd::load4f(to + t) - from4) * simd::load4f(factors + t));
+    }
+
+    // Mix each sample's value with its object's current one, four samples at
+    // a time, as InterpolationBatch does. Samples at full mix read 0 as their
+    // current value so the same sum leaves their value as is. Samples with a
+    // pose accumulate into it instead.
+    Core* targets[kCapacity];
+    float values[kCapacity];
+    float current[kCapacity];
+    float mixes[kCapacity];
+    int laneCount = 0;
+    for (size_t i = 0; i < group.count; i++)
+    {
+        Core* object = objects[i];
+        if (object == nullptr)
+        {
+            continue;
+        }
+        float value = timeValues[group.timeIndices[i]];
+        float mix = group.mixes[i];
+        if (group.poses[i] != nullptr)
+        {
+            group.poses[i]->accumulate(object, m_Accessor, value, mix);
+            continue;
+        }
+        int lane = laneCount++;
+        targets[lane] = object;
+        values[lane] = value;
+        mixes[lane] = mix;
+        current[lane] = mix == 1.0f ? 0.0f : m_Accessor.getDouble(object);
+    }
+    for (int i = laneCount; i < ((laneCount + 3) & ~3); i++)
+    {
+        values[i] = current[i] = mixes[i] = 0.0f;
+    }
+    for (int i = 0; i < laneCount; i += 4)
+    {
+        float4 mix4 = simd::load4f(mixes + i);
+        simd::store(values + i,
+                    simd::load4f(current + i) * (1.0f - mix4) + simd::load4f(values + i) * mix4);
+    }
+    for (int i = 0; i < laneCount; i++)
+    {
+        m_Accessor.setDouble(targets[i], values[i]);
+    }
+}
+
 StatusCode KeyedProperty::onAddedDirty(CoreContext* context)
 {
     StatusCode code;
@@ -88,6 +456,61 @@ StatusCode KeyedProperty::onAddedDirty(CoreContext* context)
             return code;
         }
     }
+
+    m_Seconds.clear();
+    m_Seconds.reserve(m_KeyFrames.size());
+    for (auto& keyframe : m_KeyFrames)
+    {
+        m_Seconds.push_back(keyframe->seconds());
+    }
+
+    // Look up the accessor once so applying doesn't have to switch on the
+    // property key for every keyframe. A property with no setter for the type
+    // of its keyframes stays unbound, just like the registry would ignore it.
+    if (m_KeyFrames.empty())
+    {
+        return StatusCode::Ok;
+    }
+    uint16_t typeKey = m_KeyFrames.front()->coreType();
+    for (auto& keyframe : m_KeyFrames)
+    {
+        // Keyframes interpolate towards the next one assuming it's of their
+        // own type, a property mixing them is left unbound.
+        if (keyframe->coreType() != typeKey)
+        {
+            fprintf(stderr,
+                    "KeyedProperty %u mixes keyframe types, it won't be applied.\n",
+                    propertyKey());
+            m_IsBound = false;
+            return StatusCode::Ok;
+        }
+    }
+    int key = propertyKey();
+    switch (typeKey)
+    {
+        case KeyFrameDoubleBase::typeKey:
+            m_Accessor.setDouble = CoreRegistry::doubleSetter(key);
+            m_Accessor.getDouble = CoreRegistry::doubleGetter(key);
+            m_IsBound = m_Accessor.setDouble != nullptr;
+            break;
+        case KeyFrameColorBase::typeKey:
+            m_Accessor.setColor = CoreRegistry::colorSetter(key);
+            m_Accessor.getColor = CoreRegistry::colorGetter(key);
+            m_IsBound = m_Accessor.setColor != nullptr;
+            break;
+        case KeyFrameBoolBase::typeKey:
+            m_Accessor.setBool = CoreRegistry::boolSetter(key);
+            m_IsBound = m_Accessor.setBool != nullptr;
+            break;
+        case KeyFrameIdBase::typeKey:
+            m_Accessor.setUint = CoreRegistry::uintSetter(key);
+            m_IsBound = m_Accessor.setUint != nullptr;
+            break;
+        case KeyFrameStringBase::typeKey:
+            m_Accessor.setString = CoreRegistry::stringSetter(key);
+            m_IsBound = m_Accessor.setString != nullptr;
+            break;
+    }
     return StatusCode::Ok;
 }
 
@@ -101,9 +524,59 @@ StatusCode KeyedProperty::onAddedClean(CoreContext* context)
             return code;
         }
     }
+    compact();
     return StatusCode::Ok;
 }
 
+void KeyedProperty::compact()
+{
+    if (!m_IsBound || m_KeyFrames.empty())
+    {
+        return;
+    }
+    // Bound properties have keyframes of a single type.
+    uint16_t typeKey = m_KeyFrames.front()->coreType();
+    if (typeKey != KeyFrameDoubleBase::typeKey && typeKey != KeyFrameColorBase::typeKey)
+    {
+        return;
+    }
+
+    m_Interpolations.reserve(m_KeyFrames.size());
+    for (auto& keyframe : m_KeyFrames)
+    {
+        if (typeKey == KeyFrameDoubleBase::typeKey)
+        {
+            m_DoubleValues.push_back(keyframe->as<KeyFrameDouble>()->value());
+        }
+        else
+        {
+            m_ColorValues.push_back(keyframe->as<KeyFrameColor>()->value());
+        }
+
+        CubicInterpolator* cubic = keyframe->interpolator();
+        if (keyframe->interpolationType() == 0)
+        {
+            m_Interpolations.push_back(kHold);
+        }
+        else if (cubic == nullptr)
+        {
+            m_Interpolations.push_back(kLinear);
+        }
+        else
+        {
+            auto itr = std::find(m_Interpolators.begin(), m_Interpolators.end(), cubic);
+            if (itr == m_Interpolators.end())
+            {
+                itr = m_Interpolators.insert(itr, cubic);
+            }
+            m_Interpolations.push_back(
+                (uint16_t)(kCubic + std::distance(m_Interpolators.begin(), itr)));
+        }
+    }
+    m_KeyFrames.clear();
+    m_KeyFrames.shrink_to_fit();
+}
+
 StatusCode KeyedProperty::import(ImportStack& importStack)
 {
     auto importer = importStack.latest<KeyedObjectImporter>(KeyedObjectBase::typeKey);
@@ -1,18 +1,17 @@
 #include "rive/animation/keyframe_bool.hpp"
-#include "rive/generated/core_registry.hpp"
 
 using namespace rive;
 
-void KeyFrameBool::apply(Core* object, int propertyKey, float mix)
+void KeyFrameBool::apply(Core* object, const KeyFramePropertyAccessor& accessor, float mix)
 {
-    CoreRegistry::setBool(object, propertyKey, value());
+    accessor.setBool(object, value());
 }
 
 void KeyFrameBool::applyInterpolation(Core* object,
-                                      int propertyKey,
+                                      const KeyFramePropertyAccessor& accessor,
                                       float currentTime,
                                       const KeyFrame* nextFrame,
                                       float mix)
 {
-    CoreRegistry::setBool(object, propertyKey, value());
+    accessor.setBool(object, value());
 }
\ No newline at end of file
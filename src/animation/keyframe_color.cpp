@@ -1,29 +1,30 @@
 #include "rive/animation/keyframe_color.hpp"
-#include "rive/generated/core_registry.hpp"
+#include "rive/animation/cubic_interpolator.hpp"
 #include "rive/shapes/paint/color.hpp"
 
 using namespace rive;
 
-static void applyColor(Core* object, int propertyKey, float mix, int value)
+static void
+applyColor(Core* object, const KeyFramePropertyAccessor& accessor, float mix, int value)
 {
     if (mix == 1.0f)
     {
-        CoreRegistry::setColor(object, propertyKey, value);
+        accessor.setColor(object, value);
     }
     else
     {
-        auto mixedColor = colorLerp(CoreRegistry::getColor(object, propertyKey), value, mix);
-        CoreRegistry::setColor(object, propertyKey, mixedColor);
+        auto mixedColor = colorLerp(accessor.getColor(object), value, mix);
+        accessor.setColor(object, mixedColor);
     }
 }
 
-void KeyFrameColor::apply(Core* object, int propertyKey, float mix)
+void KeyFrameColor::apply(Core* object, const KeyFramePropertyAccessor& accessor, float mix)
 {
-    applyColor(object, propertyKey, mix, value());
+    applyColor(object, accessor, mix, value());
 }
 
 void KeyFrameColor::applyInterpolation(Core* object,
-                                       int propertyKey,
+                                       const KeyFramePropertyAccessor& accessor,
                                        float currentTime,
                                        const KeyFrame* nextFrame,
                                        float mix)
@@ -37,5 +38,5 @@ void KeyFrameColor::applyInterpolation(Core* object,
         f = cubic->transform(f);
     }
 
-    applyColor(object, propertyKey, mix, colorLerp(value(), nextColor.value(), f));
+    applyColor(object, accessor, mix, colorLerp(value(), nextColor.value(), f));
 }
\ No newline at end of file
@@ -1,5 +1,5 @@
 #include "rive/animation/keyframe_double.hpp"
-#include "rive/generated/core_registry.hpp"
+#include "rive/animation/cubic_interpolator.hpp"
 
 using namespace rive;
 
@@ -8,28 +8,27 @@ using namespace rive;
 // floating point numbers suffice. So even though this is a "double keyframe" to
 // match editor names, the actual values are stored and applied in 32 bits.
 
-static void applyDouble(Core* object, int propertyKey, float mix, float value)
+static void
+applyDouble(Core* object, const KeyFramePropertyAccessor& accessor, float mix, float value)
 {
     if (mix == 1.0f)
     {
-        CoreRegistry::setDouble(object, propertyKey, value);
+        accessor.setDouble(object, value);
     }
     else
     {
         float mixi = 1.0f - mix;
-        CoreRegistry::setDouble(object,
-                                propertyKey,
-                                CoreRegistry::getDouble(object, propertyKey) * mixi + value * mix);
+        accessor.setDouble(object, accessor.getDouble(object) * mixi + value * mix);
     }
 }
 
-void KeyFrameDouble::apply(Core* object, int propertyKey, float mix)
+void KeyFrameDouble::apply(Core* object, const KeyFramePropertyAccessor& accessor, float mix)
 {
-    applyDouble(object, propertyKey, mix, value());
+    applyDouble(object, accessor, mix, value());
 }
 
 void KeyFrameDouble::applyInterpolation(Core* object,
-                                        int propertyKey,
+                                        const KeyFramePropertyAccessor& accessor,
                                         float currentTime,
                                         const KeyFrame* nextFrame,
                                         float mix)
@@ -48,5 +47,5 @@ void KeyFrameDouble::applyInterpolation(Core* object,
         frameValue = value() + (nextDouble.value() - value()) * f;
     }
 
-    applyDouble(object, propertyKey, mix, frameValue);
+    applyDouble(object, accessor, mix, frameValue);
 }
\ No newline at end of file
@@ -1,18 +1,17 @@
 #include "rive/animation/keyframe_id.hpp"
-#include "rive/generated/core_registry.hpp"
 
 using namespace rive;
 
-void KeyFrameId::apply(Core* object, int propertyKey, float mix)
+void KeyFrameId::apply(Core* object, const KeyFramePropertyAccessor& accessor, float mix)
 {
-    CoreRegistry::setUint(object, propertyKey, value());
+    accessor.setUint(object, value());
 }
 
 void KeyFrameId::applyInterpolation(Core* object,
-                                    int propertyKey,
+                                    const KeyFramePropertyAccessor& accessor,
                                     float currentTime,
                                     const KeyFrame* nextFrame,
                                     float mix)
 {
-    CoreRegistry::setUint(object, propertyKey, value());
+    accessor.setUint(object, value());
 }
\ No newline at end of file
@@ -1,18 +1,17 @@
 #include "rive/animation/keyframe_string.hpp"
-#include "rive/generated/core_registry.hpp"
 
 using namespace rive;
 
-void KeyFrameString::apply(Core* object, int propertyKey, float mix)
+void KeyFrameString::apply(Core* object, const KeyFramePropertyAccessor& accessor, float mix)
 {
-    CoreRegistry::setString(object, propertyKey, value());
+    accessor.setString(object, value());
 }
 
 void KeyFrameString::applyInterpolation(Core* object,
-                                        int propertyKey,
+                                        const KeyFramePropertyAccessor& accessor,
                                         float currentTime,
                                         const KeyFrame* nextFrame,
                                         float mix)
 {
-    CoreRegistry::setString(object, propertyKey, value());
+    accessor.setString(object, value());
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "rive/generated/animation/state_machine_layer_base.hpp"
 #include "rive/animation/state_transition.hpp"
 #include "rive/animation/system_state_instance.hpp"
+#include <algorithm>
 
 using namespace rive;
 
@@ -32,13 +33,30 @@ StatusCode LayerState::onAddedDirty(CoreContext* context)
 StatusCode LayerState::onAddedClean(CoreContext* context)
 {
     StatusCode code;
+    m_TransitionInputs.clear();
+    m_HasExitTimeTransition = false;
     for (auto transition : m_Transitions)
     {
         if ((code = transition->onAddedClean(context)) != StatusCode::Ok)
         {
             return code;
         }
+        if (transition->isDisabled())
+        {
+            continue;
+        }
+        if (transition->enableExitTime())
+        {
+            m_HasExitTimeTransition = true;
+        }
+        for (size_t i = 0, count = transition->conditionCount(); i < count; i++)
+        {
+            m_TransitionInputs.push_back(transition->condition(i)->inputId());
+        }
     }
+    std::sort(m_TransitionInputs.begin(), m_TransitionInputs.end());
+    m_TransitionInputs.erase(std::unique(m_TransitionInputs.begin(), m_TransitionInputs.end()),
+                             m_TransitionInputs.end());
     return StatusCode::Ok;
 }
 
@@ -1,8 +1,11 @@
 #include "rive/animation/linear_animation.hpp"
+#include "rive/animation/interpolation_batch.hpp"
 #include "rive/animation/keyed_object.hpp"
 #include "rive/artboard.hpp"
 #include "rive/importers/artboard_importer.hpp"
 #include "rive/importers/import_stack.hpp"
+#include "rive/profiler.hpp"
+#include <algorithm>
 #include <cmath>
 
 using namespace rive;
@@ -51,11 +54,106 @@ void LinearAnimation::addKeyedObject(std::unique_ptr<KeyedObject> object)
     m_KeyedObjects.push_back(std::move(object));
 }
 
-void LinearAnimation::apply(Artboard* artboard, float time, float mix) const
+size_t LinearAnimation::keyedPropertyCount() const
 {
+    size_t count = 0;
     for (const auto& object : m_KeyedObjects)
     {
-        object->apply(artboard, time, mix);
+        count += object->keyedPropertyCount();
+    }
+    return count;
+}
+
+void LinearAnimation::resolveKeyedObjects(const Artboard* artboard,
+                                          std::vector<Core*>& objects) const
+{
+    objects.clear();
+    objects.reserve(m_KeyedObjects.size());
+    for (const auto& object : m_KeyedObjects)
+    {
+        objects.push_back(artboard->resolve(object->objectId()));
+    }
+}
+
+void LinearAnimation::apply(Artboard* artboard,
+                            float time,
+                            float mix,
+                            uint32_t* keyFrameCursors,
+                            Core* const* keyedObjects,
+                            PoseBuffer* pose) const
+{
+    RIVE_PROFILE_SCOPE(keyFrameApply);
+    // Double properties are interpolated several at a time, they're written
+    // (or accumulated into the pose) when the batch goes out of scope.
+    InterpolationBatch batch(mix, pose);
+    for (const auto& object : m_KeyedObjects)
+    {
+        if (keyedObjects == nullptr)
+        {
+            object->apply(artboard, time, mix, keyFrameCursors, &batch);
+        }
+        else if (Core* target = *keyedObjects++)
+        {
+            object->apply(target, time, mix, keyFrameCursors, &batch);
+        }
+        if (keyFrameCursors != nullptr)
+        {
+            keyFrameCursors += object->keyedPropertyCount();
+        }
+    }
+}
+
+void LinearAnimation::applyBatch(Span<const AnimationSample> samples) const
+{
+    RIVE_PROFILE_SCOPE(keyFrameApply);
+    const size_t kCapacity = AnimationSampleGroup::kCapacity;
+    uint8_t order[kCapacity];
+    float mixes[kCapacity];
+    PoseBuffer* poses[kCapacity];
+    float times[kCapacity];
+    uint8_t timeIndices[kCapacity];
+    uint32_t* cursors[kCapacity];
+    Core* objects[kCapacity];
+    for (size_t start = 0; start < samples.size(); start += kCapacity)
+    {
+        size_t count = std::min(kCapacity, samples.size() - start);
+        const AnimationSample* samplesInGroup = samples.data() + start;
+        AnimationSampleGroup group = {count, mixes, poses, 0, times, timeIndices};
+
+        // A crowd is usually a handful of phases of the same animation, find
+        // the distinct times so each is only evaluated once.
+        for (size_t i = 0; i < count; i++)
+        {
+            order[i] = (uint8_t)i;
+            mixes[i] = samplesInGroup[i].mix;
+            poses[i] = samplesInGroup[i].pose;
+            cursors[i] = samplesInGroup[i].keyFrameCursors;
+        }
+        std::sort(order, order + count, [samplesInGroup](uint8_t a, uint8_t b) {
+            return samplesInGroup[a].time < samplesInGroup[b].time;
+        });
+        for (size_t i = 0; i < count; i++)
+        {
+            float time = samplesInGroup[order[i]].time;
+            if (group.timeCount == 0 || time != times[group.timeCount - 1])
+            {
+                times[group.timeCount++] = time;
+            }
+            timeIndices[order[i]] = (uint8_t)(group.timeCount - 1);
+        }
+
+        for (size_t k = 0; k < m_KeyedObjects.size(); k++)
+        {
+            const auto& object = m_KeyedObjects[k];
+            for (size_t i = 0; i < count; i++)
+            {
+                const AnimationSample& sample = samplesInGroup[i];
+                objects[i] = sample.keyedObjects != nullptr
+                                 ? sample.keyedObjects[k]
+                                 : sample.artboard->resolve(object->objectId());
+            }
+            object->applyBatch(group, objects, cursors);
+        }
     }
 }
 
@@ -16,8 +16,10 @@ LinearAnimationInstance::LinearAnimationInstance(const LinearAnimation* animatio
     m_TotalTime(0.0f),
     m_LastTotalTime(0.0f),
     m_SpilledTime(0.0f),
-    m_Direction(1)
+    m_Direction(1),
+    m_KeyFrameCursors(animation->keyedPropertyCount(), 0)
 {
+    animation->resolveKeyedObjects(instance, m_KeyedObjects);
     Counter::update(Counter::kLinearAnimationInstance, +1);
 }
 
@@ -30,7 +32,9 @@ LinearAnimationInstance::LinearAnimationInstance(LinearAnimationInstance const&
     m_SpilledTime(lhs.m_SpilledTime),
     m_Direction(lhs.m_Direction),
     m_DidLoop(lhs.m_DidLoop),
-    m_LoopValue(lhs.m_LoopValue)
+    m_LoopValue(lhs.m_LoopValue),
+    m_KeyFrameCursors(lhs.m_KeyFrameCursors),
+    m_KeyedObjects(lhs.m_KeyedObjects)
 {
     Counter::update(Counter::kLinearAnimationInstance, +1);
 }
@@ -179,6 +183,16 @@ void LinearAnimationInstance::reset(float speedMultiplier = 1.0)
     m_Time = (speedMultiplier >= 0) ? m_Animation->startTime() : m_Animation->endTime();
 }
 
+void LinearAnimationInstance::resetForReuse(float speedMultiplier)
+{
+    reset(speedMultiplier);
+    m_TotalTime = 0.0f;
+    m_LastTotalTime = 0.0f;
+    m_SpilledTime = 0.0f;
+    m_Direction = 1;
+    m_DidLoop = false;
+}
+
 uint32_t LinearAnimationInstance::fps() const { return m_Animation->fps(); }
 
 uint32_t LinearAnimationInstance::duration() const { return m_Animation->duration(); }
@@ -0,0 +1,129 @@
+#include "rive/animation/pose_buffer.hpp"
+
+using namespace rive;
+
+static const size_t kInitialSlotCount = 64;
+
+PoseBuffer::PoseBuffer() : m_Slots(kInitialSlotCount, 0) {}
+
+// Two animations keying the same property of the same object have their own
+// accessors, but they resolve to the same setter. Only the setter of the
+// property's own type is read, the others share its storage.
+static inline uintptr_t setterOf(const KeyFramePropertyAccessor& accessor, bool isColor)
+{
+    return isColor ? reinterpret_cast<uintptr_t>(accessor.setColor)
+                   : reinterpret_cast<uintptr_t>(accessor.setDouble);
+}
+
+uint32_t PoseBuffer::findSlot(Core* object,
+                              const KeyFramePropertyAccessor& accessor,
+                              bool isColor) const
+{
+    uintptr_t setter = setterOf(accessor, isColor);
+    uintptr_t key = reinterpret_cast<uintptr_t>(object) ^ (setter * 31);
+    key ^= key >> 17;
+    key *= 0x9E3779B1u;
+    uint32_t mask = (uint32_t)m_Slots.size() - 1;
+    uint32_t slot = (uint32_t)(key ^ (key >> 15)) & mask;
+    while (true)
+    {
+        uint32_t index = m_Slots[slot];
+        if (index == 0)
+        {
+            return slot;
+        }
+        const Entry& entry = m_Entries[index - 1];
+        if (entry.object == object && entry.isColor == isColor &&
+            setterOf(*entry.accessor, isColor) == setter)
+        {
+            return slot;
+        }
+        slot = (slot + 1) & mask;
+    }
+}
+
+void PoseBuffer::grow()
+{
+    m_Slots.assign(m_Slots.size() * 2, 0);
+    for (size_t i = 0; i < m_Entries.size(); i++)
+    {
+        Entry& entry = m_Entries[i];
+        entry.slot = findSlot(entry.object, *entry.accessor, entry.isColor);
+        m_Slots[entry.slot] = (uint32_t)i + 1;
+    }
+}
+
+PoseBuffer::Entry* PoseBuffer::find(Core* object,
+                                    const KeyFramePropertyAccessor& accessor,
+                                    bool isColor,
+                                    uint32_t* slot)
+{
+    *slot = findSlot(object, accessor, isColor);
+    uint32_t index = m_Slots[*slot];
+    return index != 0 ? &m_Entries[index - 1] : nullptr;
+}
+
+void PoseBuffer::add(const Entry& entry)
+{
+    m_Entries.push_back(entry);
+    m_Slots[entry.slot] = (uint32_t)m_Entries.size();
+    if (m_Entries.size() * 2 > m_Slots.size())
+    {
+        grow();
+    }
+}
+
+void PoseBuffer::accumulate(Core* object,
+                            const KeyFramePropertyAccessor& accessor,
+                            float value,
+                            float mix)
+{
+    uint32_t slot;
+    if (Entry* entry = find(object, accessor, false, &slot))
+    {
+        entry->value = mix == 1.0f ? value : entry->value * (1.0f - mix) + value * mix;
+        return;
+    }
+
+    if (mix != 1.0f)
+    {
+        value = accessor.getDouble(object) * (1.0f - mix) + value * mix;
+    }
+    add({object, &accessor, value, 0, slot, false});
+}
+
+void PoseBuffer::accumulateColor(Core* object,
+                                 const KeyFramePropertyAccessor& accessor,
+                                 ColorInt value,
+                                 float mix)
+{
+    uint32_t slot;
+    if (Entry* entry = find(object, accessor, true, &slot))
+    {
+        entry->color = mix == 1.0f ? value : colorLerp(entry->color, value, mix);
+        return;
+    }
+
+    if (mix != 1.0f)
+    {
+        value = colorLerp(accessor.getColor(object), value, mix);
+    }
+    add({object, &accessor, 0.0f, value, slot, true});
+}
+
+void PoseBuffer::write()
+{
+    for (const Entry& entry : m_Entries)
+    {
+        if (entry.isColor)
+        {
+            entry.accessor->setColor(entry.object, (int)entry.color);
+        }
+        else
+        {
+            entry.accessor->setDouble(entry.object, entry.value);
+        }
+        m_Slots[entry.slot] = 0;
+    }
+    m_Entries.clear();
+}
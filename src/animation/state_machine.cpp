@@ -91,16 +91,17 @@ void StateMachine::addListener(std::unique_ptr<StateMachineListener> listener)
     m_Listeners.push_back(std::move(listener));
 }
 
-const StateMachineInput* StateMachine::input(std::string name) const
+const NameIndex& StateMachine::inputNames() const
 {
-    for (auto& input : m_Inputs)
-    {
-        if (input->name() == name)
-        {
-            return input.get();
-        }
-    }
-    return nullptr;
+    m_InputNames.buildOnce(m_Inputs.size(), [&](size_t i) { return &m_Inputs[i]->name(); });
+    return m_InputNames;
+}
+
+const StateMachineInput* StateMachine::input(StringView name) const
+{
+    size_t index =
+        inputNames().find(name, [&](size_t i) { return name == m_Inputs[i]->name(); });
+    return index == NameIndex::npos ? nullptr : m_Inputs[index].get();
 }
 
 const StateMachineInput* StateMachine::input(size_t index) const
@@ -112,7 +113,7 @@ const StateMachineInput* StateMachine::input(size_t index) const
     return nullptr;
 }
 
-const StateMachineLayer* StateMachine::layer(std::string name) const
+const StateMachineLayer* StateMachine::layer(StringView name) const
 {
     for (auto& layer : m_Layers)
     {
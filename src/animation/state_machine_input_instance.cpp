@@ -14,7 +14,13 @@ uint16_t SMIInput::inputCoreType() const { return m_Input->coreType(); }
 
 const std::string& SMIInput::name() const { return m_Input->name(); }
 
-void SMIInput::valueChanged() { m_MachineInstance->markNeedsAdvance(); }
+void SMIInput::valueChanged()
+{
+    stampChanged();
+    m_MachineInstance->markNeedsAdvance();
+}
+
+void SMIInput::stampChanged() { m_ChangedAt = ++m_MachineInstance->m_InputChanges; }
 
 // bool
 
@@ -61,3 +67,12 @@ void SMITrigger::fire()
     m_Fired = true;
     valueChanged();
 }
+
+void SMITrigger::advanced()
+{
+    if (m_Fired)
+    {
+        m_Fired = false;
+        stampChanged();
+    }
+}
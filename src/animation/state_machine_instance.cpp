@@ -4,6 +4,7 @@
 #include "rive/animation/cubic_interpolator.hpp"
 #include "rive/animation/entry_state.hpp"
 #include "rive/animation/nested_state_machine.hpp"
+#include "rive/animation/pose_buffer.hpp"
 #include "rive/animation/state_instance.hpp"
 #include "rive/animation/state_machine_bool.hpp"
 #include "rive/animation/state_machine_input_instance.hpp"
@@ -20,14 +21,18 @@
 #include "rive/math/hit_test.hpp"
 #include "rive/nested_animation.hpp"
 #include "rive/nested_artboard.hpp"
+#include "rive/profiler.hpp"
 #include "rive/rive_counter.hpp"
 #include "rive/shapes/shape.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iterator>
 #include <unordered_map>
 
 using namespace rive;
 namespace rive
 {
-class StateMachineLayerInstance
+class StateMachineLayerInstance : public Allocated
 {
 private:
     static const int maxIterations = 100;
@@ -37,6 +42,10 @@ private:
     StateInstance* m_AnyStateInstance = nullptr;
     StateInstance* m_CurrentState = nullptr;
     StateInstance* m_StateFrom = nullptr;
+    /// One instance per state of the layer (matching the layer's state
+    /// indices), made the first time the state is entered and reset each
+    /// time it's entered again.
+    std::vector<StateInstance*> m_StateInstances;
 
     // const LayerState* m_CurrentState = nullptr;
     // const LayerState* m_StateFrom = nullptr;
@@ -53,20 +62,35 @@ private:
     /// Used to ensure a specific animation is applied on the next apply.
     const LinearAnimation* m_HoldAnimation = nullptr;
     float m_HoldTime = 0.0f;
+    /// Shared by all the layers of the state machine.
+    PoseBuffer* m_Pose = nullptr;
+
+    /// The machine's input change count as of this advance.
+    uint32_t m_InputChanges = 0;
+    /// The state whose transitions (along with the any state's) were last
+    /// evaluated without changing state, and the input change count at the
+    /// time. Until one of the inputs they read changes they can't be taken.
+    const LayerState* m_EvaluatedState = nullptr;
+    uint32_t m_EvaluatedAt = 0;
+    size_t m_EvaluatedConditions = 0;
 
 public:
     ~StateMachineLayerInstance()
     {
         delete m_AnyStateInstance;
-        delete m_CurrentState;
-        delete m_StateFrom;
+        for (auto instance : m_StateInstances)
+        {
+            delete instance;
+        }
     }
 
-    void init(const StateMachineLayer* layer, ArtboardInstance* instance)
+    void init(const StateMachineLayer* layer, ArtboardInstance* instance, PoseBuffer* pose)
     {
         m_ArtboardInstance = instance;
+        m_Pose = pose;
         assert(m_Layer == nullptr);
         m_AnyStateInstance = layer->anyState()->makeInstance(instance).release();
+        m_StateInstances.resize(layer->stateCount(), nullptr);
         m_Layer = layer;
         changeState(m_Layer->entryState());
     }
@@ -85,9 +109,10 @@ public:
         }
     }
 
-    bool advance(float seconds, Span<SMIInput*> inputs)
+    bool advance(float seconds, Span<SMIInput*> inputs, uint32_t inputChanges)
     {
         m_StateChangedOnAdvance = false;
+        m_InputChanges = inputChanges;
 
         if (m_CurrentState != nullptr && m_CurrentState->keepGoing())
         {
@@ -139,12 +164,43 @@ public:
 
         m_WaitingForExit = false;
 
-        if (tryChangeState(m_AnyStateInstance, inputs, ignoreTriggers))
+        if (m_EvaluatedState != nullptr && m_EvaluatedState == currentState() &&
+            !inputsChanged(m_AnyStateInstance->state(), inputs) &&
+            !inputsChanged(m_EvaluatedState, inputs))
+        {
+            return false;
+        }
+        m_EvaluatedState = nullptr;
+
+        if (tryChangeState(m_AnyStateInstance, inputs, ignoreTriggers) ||
+            tryChangeState(m_CurrentState, inputs, ignoreTriggers))
         {
             return true;
         }
 
-        return tryChangeState(m_CurrentState, inputs, ignoreTriggers);
+        // Triggers may have been ignored, in which case the result could
+        // differ once they aren't.
+        if (!ignoreTriggers && m_CurrentState != nullptr &&
+            !m_AnyStateInstance->state()->hasExitTimeTransition() &&
+            !m_CurrentState->state()->hasExitTimeTransition())
+        {
+            m_EvaluatedState = m_CurrentState->state();
+            m_EvaluatedAt = m_InputChanges;
+        }
+        return false;
+    }
+
+    bool inputsChanged(const LayerState* state, Span<SMIInput*> inputs) const
+    {
+        for (auto id : state->transitionInputs())
+        {
+            auto input = inputs[id];
+            if (input != nullptr && input->m_ChangedAt > m_EvaluatedAt)
+            {
+                return true;
+            }
+        }
+        return false;
     }
 
     bool changeState(const LayerState* stateTo)
@@ -153,11 +209,43 @@ public:
         {
             return false;
         }
-        m_CurrentState =
-            stateTo == nullptr ? nullptr : stateTo->makeInstance(m_ArtboardInstance).release();
+        m_CurrentState = stateTo == nullptr ? nullptr : instanceOf(stateTo);
         return true;
     }
 
+    /// The pooled instance of stateTo, ready to be entered.
+    StateInstance* instanceOf(const LayerState* stateTo)
+    {
+        size_t index = 0;
+        size_t count = m_StateInstances.size();
+        for (; index < count; index++)
+        {
+            // States that aren't in the layer are pooled after its states.
+            const LayerState* state = index < m_Layer->stateCount()
+                                          ? m_Layer->state(index)
+                                          : m_StateInstances[index]->state();
+            if (state == stateTo)
+            {
+                break;
+            }
+        }
+        if (index == count)
+        {
+            m_StateInstances.push_back(nullptr);
+        }
+        StateInstance*& instance = m_StateInstances[index];
+        if (instance == nullptr)
+        {
+            AllocatorScope scope(m_ArtboardInstance->allocator());
+            instance = stateTo->makeInstance(m_ArtboardInstance).release();
+        }
+        else
+        {
+            instance->reset();
+        }
+        return instance;
+    }
+
     bool tryChangeState(StateInstance* stateFromInstance,
                         Span<SMIInput*> inputs,
                         bool ignoreTriggers)
@@ -171,17 +259,14 @@ public:
         for (size_t i = 0, length = stateFrom->transitionCount(); i < length; i++)
         {
             auto transition = stateFrom->transition(i);
-            auto allowed = transition->allowed(stateFromInstance, inputs, ignoreTriggers);
+            auto allowed =
+                transition->allowed(stateFromInstance, inputs, ignoreTriggers, &m_EvaluatedConditions);
             if (allowed == AllowTransition::yes && changeState(transition->stateTo()))
             {
                 m_StateChangedOnAdvance = true;
                 // state actually has changed
                 m_Transition = transition;
-                if (m_StateFrom != m_AnyStateInstance)
-                {
-                    // Old state from is done.
-                    delete m_StateFrom;
-                }
+                // Old state from is done, its instance stays pooled.
                 m_StateFrom = outState;
 
                 // If we had an exit time and wanted to pause on exit, make
@@ -228,9 +313,13 @@ public:
 
     void apply(/*Artboard* artboard*/)
     {
+        // Everything mixed in by this layer (the held animation, the state
+        // we're transitioning from and the current state) is accumulated
+        // and each property written once.
         if (m_HoldAnimation != nullptr)
         {
-            m_HoldAnimation->apply(m_ArtboardInstance, m_HoldTime, m_MixFrom);
+            m_HoldAnimation
+                ->apply(m_ArtboardInstance, m_HoldTime, m_MixFrom, nullptr, nullptr, m_Pose);
             m_HoldAnimation = nullptr;
         }
 
@@ -243,17 +332,20 @@ public:
         if (m_StateFrom != nullptr && m_Mix < 1.0f)
         {
             auto fromMix = cubic != nullptr ? cubic->transform(m_MixFrom) : m_MixFrom;
-            m_StateFrom->apply(fromMix);
+            m_StateFrom->apply(fromMix, m_Pose);
         }
         if (m_CurrentState != nullptr)
         {
             auto mix = cubic != nullptr ? cubic->transform(m_Mix) : m_Mix;
-            m_CurrentState->apply(mix);
+            m_CurrentState->apply(mix, m_Pose);
         }
+        m_Pose->write();
     }
 
     bool stateChangedOnAdvance() const { return m_StateChangedOnAdvance; }
 
+    size_t evaluatedConditionCount() const { return m_EvaluatedConditions; }
+
     const LayerState* currentState()
     {
         return m_CurrentState == nullptr ? nullptr : m_CurrentState->state();
@@ -272,21 +364,175 @@ public:
 /// Representation of a Shape from the Artboard Instance and all the listeners it
 /// triggers. Allows tracking hover and performing hit detection only once on
 /// shapes that trigger multiple listeners.
-class HitShape
+class HitShape : public Allocated
 {
 private:
     Shape* m_Shape;
 
+    AABB m_Bounds;
+    uint32_t m_BoundsVersion = 0;
+    bool m_HasBounds = false;
+
 public:
     Shape* shape() const { return m_Shape; }
     HitShape(Shape* shape) : m_Shape(shape) {}
     bool isHovered = false;
     std::vector<const StateMachineListener*> listeners;
+
+    const AABB& bounds() const { return m_Bounds; }
+
+    /// Recomputes the world bounds if the shape's paths changed since they
+    /// were last computed, returns true when they were.
+    bool updateBounds()
+    {
+        uint32_t version = m_Shape->pathComposer()->version();
+        if (m_HasBounds && version == m_BoundsVersion)
+        {
+            return false;
+        }
+        m_Bounds = m_Shape->computeWorldBounds();
+        m_BoundsVersion = version;
+        m_HasBounds = true;
+        return true;
+    }
+
+    bool boundsIntersect(const IAABB& area) const
+    {
+        return m_Bounds.minX <= area.right && m_Bounds.maxX >= area.left &&
+               m_Bounds.minY <= area.bottom && m_Bounds.maxY >= area.top;
+    }
+};
+
+/// Uniform grid over the bounds of the hit shapes. Each cell lists, in
+/// ascending order, the hit shapes whose bounds (grown by a margin) overlap
+/// it.
+class HitShapeGrid : public Allocated
+{
+private:
+    static const int maxDimension = 64;
+
+    AABB m_Bounds;
+    int m_Columns = 0;
+    int m_Rows = 0;
+    float m_CellWidth = 1.0f;
+    float m_CellHeight = 1.0f;
+    /// Cell i's shapes are m_Entries[m_CellStarts[i]..m_CellStarts[i + 1]).
+    std::vector<uint32_t> m_CellStarts;
+    std::vector<uint32_t> m_Entries;
+
+    static bool isValid(const AABB& bounds)
+    {
+        // Also false for NaNs.
+        return bounds.minX <= bounds.maxX && bounds.minY <= bounds.maxY &&
+               std::isfinite(bounds.minX) && std::isfinite(bounds.maxX) &&
+               std::isfinite(bounds.minY) && std::isfinite(bounds.maxY);
+    }
+
+    int column(float x) const
+    {
+        return (int)std::min((float)(m_Columns - 1),
+                             std::max(0.0f, (x - m_Bounds.minX) / m_CellWidth));
+    }
+
+    int row(float y) const
+    {
+        return (int)std::min((float)(m_Rows - 1),
+                             std::max(0.0f, (y - m_Bounds.minY) / m_CellHeight));
+    }
+
+public:
+    void build(const std::vector<std::unique_ptr<HitShape>>& hitShapes, float margin)
+    {
+        m_Bounds = AABB::forExpansion();
+        size_t count = 0;
+        for (const auto& hitShape : hitShapes)
+        {
+            if (isValid(hitShape->bounds()))
+            {
+                m_Bounds.expand(hitShape->bounds().inset(-margin, -margin));
+                count++;
+            }
+        }
+        if (count == 0)
+        {
+            m_Columns = m_Rows = 0;
+            return;
+        }
+
+        // Roughly one shape per cell.
+        int dimension = std::min((int)maxDimension, std::max(1, (int)std::ceil(std::sqrt(count))));
+        m_Columns = m_Rows = dimension;
+        m_CellWidth = std::max(m_Bounds.width() / m_Columns, 1.0f);
+        m_CellHeight = std::max(m_Bounds.height() / m_Rows, 1.0f);
+
+        // Count, then fill, the entries of each cell.
+        m_CellStarts.assign(m_Columns * m_Rows + 1, 0);
+        for (int pass = 0; pass < 2; pass++)
+        {
+            for (uint32_t i = 0; i < hitShapes.size(); i++)
+            {
+                const AABB& bounds = hitShapes[i]->bounds();
+                if (!isValid(bounds))
+                {
+                    continue;
+                }
+                int left = column(bounds.minX - margin), right = column(bounds.maxX + margin);
+                int top = row(bounds.minY - margin), bottom = row(bounds.maxY + margin);
+                for (int y = top; y <= bottom; y++)
+                {
+                    for (int x = left; x <= right; x++)
+                    {
+                        size_t cell = y * m_Columns + x;
+                        if (pass == 0)
+                        {
+                            m_CellStarts[cell + 1]++;
+                        }
+                        else
+                        {
+                            m_Entries[m_CellStarts[cell]++] = i;
+                        }
+                    }
+                }
+            }
+            if (pass == 0)
+            {
+                for (size_t cell = 1; cell < m_CellStarts.size(); cell++)
+                {
+                    m_CellStarts[cell] += m_CellStarts[cell - 1];
+                }
+                m_Entries.resize(m_CellStarts.back());
+            }
+            else
+            {
+                // Filling advanced each start to the next cell's start.
+                for (size_t cell = m_CellStarts.size() - 1; cell > 0; cell--)
+                {
+                    m_CellStarts[cell] = m_CellStarts[cell - 1];
+                }
+                m_CellStarts[0] = 0;
+            }
+        }
+    }
+
+    /// The hit shapes whose bounds grown by the margin could contain
+    /// position.
+    Span<const uint32_t> query(Vec2D position) const
+    {
+        if (m_Columns == 0 || !(position.x >= m_Bounds.minX && position.x <= m_Bounds.maxX &&
+                                position.y >= m_Bounds.minY && position.y <= m_Bounds.maxY))
+        {
+            return Span<const uint32_t>(nullptr, 0);
+        }
+        size_t cell = row(position.y) * m_Columns + column(position.x);
+        return Span<const uint32_t>(m_Entries.data() + m_CellStarts[cell],
+                                    m_CellStarts[cell + 1] - m_CellStarts[cell]);
+    }
 };
 } // namespace rive
 
 void StateMachineInstance::updateListeners(Vec2D position, ListenerType hitType)
 {
+    RIVE_PROFILE_SCOPE(hitTest);
     if (m_ArtboardInstance->frameOrigin())
     {
         position -= Vec2D(m_ArtboardInstance->originX() * m_ArtboardInstance->width(),
@@ -300,12 +546,42 @@ void StateMachineInstance::updateListeners(Vec2D position, ListenerType hitType)
                         position.y + hitRadius)
                        .round();
 
+    // Refresh the bounds of the shapes whose paths changed, re-bucketing
+    // them when any did.
+    bool boundsChanged = false;
     for (const auto& hitShape : m_HitShapes)
     {
+        if (hitShape->updateBounds())
+        {
+            boundsChanged = true;
+        }
+    }
+    if (boundsChanged)
+    {
+        // Margin covers the hit radius and rounding the hit area out.
+        m_HitShapeGrid->build(m_HitShapes, hitRadius + 1.0f);
+    }
 
-        // TODO: quick reject.
+    // Only the shapes that could be under the pointer and the ones that
+    // were hovered (which may need to exit) are visited, in order.
+    auto candidates = m_HitShapeGrid->query(position);
+    m_VisitedShapes.clear();
+    std::set_union(candidates.begin(),
+                   candidates.end(),
+                   m_HoveredShapes.begin(),
+                   m_HoveredShapes.end(),
+                   std::back_inserter(m_VisitedShapes));
+    m_HoveredShapes.clear();
+
+    for (auto index : m_VisitedShapes)
+    {
+        const auto& hitShape = m_HitShapes[index];
 
-        bool isOver = hitShape->shape()->hitTest(hitArea);
+        bool isOver = hitShape->boundsIntersect(hitArea) && hitShape->shape()->hitTest(hitArea);
+        if (isOver)
+        {
+            m_HoveredShapes.push_back(index);
+        }
 
         bool hoverChange = hitShape->isHovered != isOver;
         hitShape->isHovered = isOver;
@@ -392,6 +668,7 @@ StateMachineInstance::StateMachineInstance(const StateMachine* machine,
     Scene(instance), m_Machine(machine)
 {
     Counter::update(Counter::kStateMachineInstance, +1);
+    AllocatorScope scope(m_Allocator.get());
 
     const auto count = machine->inputCount();
     m_InputInstances.resize(count);
@@ -423,7 +700,7 @@ StateMachineInstance::StateMachineInstance(const StateMachine* machine,
     m_Layers = new StateMachineLayerInstance[m_LayerCount];
     for (size_t i = 0; i < m_LayerCount; i++)
     {
-        m_Layers[i].init(machine->layer(i), m_ArtboardInstance);
+        m_Layers[i].init(machine->layer(i), m_ArtboardInstance, &m_Pose);
     }
 
     // Initialize listeners. Store a lookup table of shape id to hit shape
@@ -463,6 +740,8 @@ StateMachineInstance::StateMachineInstance(const StateMachine* machine,
         }
     }
 
+    m_HitShapeGrid = rivestd::make_unique<HitShapeGrid>();
+
     for (auto nestedArtboard : instance->nestedArtboards())
     {
         if (nestedArtboard->hasNestedStateMachines())
@@ -488,7 +767,7 @@ bool StateMachineInstance::advance(float seconds)
     m_NeedsAdvance = false;
     for (size_t i = 0; i < m_LayerCount; i++)
     {
-        if (m_Layers[i].advance(seconds, m_InputInstances))
+        if (m_Layers[i].advance(seconds, m_InputInstances, m_InputChanges))
         {
             m_NeedsAdvance = true;
         }
@@ -524,28 +803,25 @@ SMIInput* StateMachineInstance::input(size_t index) const
 }
 
 template <typename SMType, typename InstType>
-InstType* StateMachineInstance::getNamedInput(const std::string& name) const
+InstType* StateMachineInstance::getNamedInput(StringView name) const
 {
-    for (const auto inst : m_InputInstances)
-    {
-        auto input = inst->input();
-        if (input->is<SMType>() && input->name() == name)
-        {
-            return static_cast<InstType*>(inst);
-        }
-    }
-    return nullptr;
+    // The instance's inputs line up with the machine's.
+    size_t index = m_Machine->inputNames().find(name, [&](size_t i) {
+        auto inst = m_InputInstances[i];
+        return inst != nullptr && inst->input()->is<SMType>() && name == inst->input()->name();
+    });
+    return index == NameIndex::npos ? nullptr : static_cast<InstType*>(m_InputInstances[index]);
 }
 
-SMIBool* StateMachineInstance::getBool(const std::string& name) const
+SMIBool* StateMachineInstance::getBool(StringView name) const
 {
     return getNamedInput<StateMachineBool, SMIBool>(name);
 }
-SMINumber* StateMachineInstance::getNumber(const std::string& name) const
+SMINumber* StateMachineInstance::getNumber(StringView name) const
 {
     return getNamedInput<StateMachineNumber, SMINumber>(name);
 }
-SMITrigger* StateMachineInstance::getTrigger(const std::string& name) const
+SMITrigger* StateMachineInstance::getTrigger(StringView name) const
 {
     return getNamedInput<StateMachineTrigger, SMITrigger>(name);
 }
@@ -563,6 +839,16 @@ size_t StateMachineInstance::stateChangedCount() const
     return count;
 }
 
+size_t StateMachineInstance::evaluatedConditionCount() const
+{
+    size_t count = 0;
+    for (size_t i = 0; i < m_LayerCount; i++)
+    {
+        count += m_Layers[i].evaluatedConditionCount();
+    }
+    return count;
+}
+
 const LayerState* StateMachineInstance::stateChangedByIndex(size_t index) const
 {
     size_t count = 0;
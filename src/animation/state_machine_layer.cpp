@@ -5,6 +5,7 @@
 #include "rive/animation/any_state.hpp"
 #include "rive/animation/entry_state.hpp"
 #include "rive/animation/exit_state.hpp"
+#include "rive/animation/state_transition.hpp"
 
 using namespace rive;
 
@@ -58,6 +59,31 @@ StatusCode StateMachineLayer::onAddedClean(CoreContext* context)
         }
     }
 
+    // Compile the conditions into one table, reserved up front so the
+    // transitions can point into it as it's filled.
+    size_t conditionCount = 0;
+    for (auto state : m_States)
+    {
+        for (size_t i = 0, count = state->transitionCount(); i < count; i++)
+        {
+            conditionCount += state->transition(i)->conditionCount();
+        }
+    }
+    m_Conditions.clear();
+    m_Conditions.reserve(conditionCount);
+    for (auto state : m_States)
+    {
+        for (size_t i = 0, count = state->transitionCount(); i < count; i++)
+        {
+            auto transition = state->transition(i);
+            transition->m_CompiledConditions = m_Conditions.data() + m_Conditions.size();
+            for (auto condition : transition->m_Conditions)
+            {
+                m_Conditions.push_back(CompiledTransitionCondition::compile(condition));
+            }
+        }
+    }
+
     return StatusCode::Ok;
 }
 
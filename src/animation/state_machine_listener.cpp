@@ -43,30 +43,16 @@ StatusCode StateMachineListener::onAddedClean(CoreContext* context)
     auto artboard = static_cast<Artboard*>(context);
     auto target = artboard->resolve(targetId());
 
-    for (auto core : artboard->objects())
+    // Find the Shapes that are parented to the target.
+    if (target != nullptr && target->is<Component>())
     {
-        if (core == nullptr)
+        std::vector<uint32_t> ids;
+        artboard->subtreeIds(target->as<Component>(), ids);
+        for (auto id : ids)
         {
-            continue;
-        }
-
-        // Iterate artboard to find Shapes that are parented to the target
-        if (core->is<Shape>())
-        {
-            auto shape = core->as<Shape>();
-
-            for (ContainerComponent* component = shape; component != nullptr;
-                 component = component->parent())
+            if (id != 0 && artboard->objects()[id]->is<Shape>())
             {
-                if (component == target)
-                {
-                    auto index = artboard->idOf(shape);
-                    if (index != 0)
-                    {
-                        m_HitShapesIds.push_back(index);
-                    }
-                    break;
-                }
+                m_HitShapesIds.push_back(id);
             }
         }
     }
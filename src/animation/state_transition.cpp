@@ -137,22 +137,49 @@ const LinearAnimation* StateTransition::exitTimeAnimation(const LayerState* from
 
 AllowTransition StateTransition::allowed(StateInstance* stateFrom,
                                          Span<SMIInput*> inputs,
-                                         bool ignoreTriggers) const
+                                         bool ignoreTriggers,
+                                         size_t* evaluatedConditions) const
 {
     if (isDisabled())
     {
         return AllowTransition::no;
     }
 
-    for (auto condition : m_Conditions)
+    if (m_CompiledConditions != nullptr)
     {
-        // N.B. state machine instance sanitizes these for us...
-        auto input = inputs[condition->inputId()];
+        for (size_t i = 0, count = m_Conditions.size(); i < count; i++)
+        {
+            const CompiledTransitionCondition& condition = m_CompiledConditions[i];
+            if (evaluatedConditions != nullptr)
+            {
+                (*evaluatedConditions)++;
+            }
+            // N.B. state machine instance sanitizes these for us...
+            auto input = inputs[condition.inputId];
 
-        if ((ignoreTriggers && condition->is<TransitionTriggerCondition>()) ||
-            !condition->evaluate(input))
+            if ((ignoreTriggers && condition.type == CompiledTransitionCondition::Type::trigger) ||
+                !condition.evaluate(input))
+            {
+                return AllowTransition::no;
+            }
+        }
+    }
+    else
+    {
+        for (auto condition : m_Conditions)
         {
-            return AllowTransition::no;
+            if (evaluatedConditions != nullptr)
+            {
+                (*evaluatedConditions)++;
+            }
+            // N.B. state machine instance sanitizes these for us...
+            auto input = inputs[condition->inputId()];
+
+            if ((ignoreTriggers && condition->is<TransitionTriggerCondition>()) ||
+                !condition->evaluate(input))
+            {
+                return AllowTransition::no;
+            }
         }
     }
 
@@ -6,6 +6,7 @@ SystemStateInstance::SystemStateInstance(const LayerState* layerState, ArtboardI
 {}
 
 void SystemStateInstance::advance(float seconds, Span<SMIInput*>) {}
-void SystemStateInstance::apply(float mix) {}
+void SystemStateInstance::apply(float mix, PoseBuffer* pose) {}
 
-bool SystemStateInstance::keepGoing() const { return false; }
\ No newline at end of file
+bool SystemStateInstance::keepGoing() const { return false; }
+void SystemStateInstance::reset() {}
\ No newline at end of file
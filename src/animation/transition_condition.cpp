@@ -1,4 +1,7 @@
 #include "rive/animation/transition_bool_condition.hpp"
+#include "rive/animation/transition_number_condition.hpp"
+#include "rive/animation/transition_trigger_condition.hpp"
+#include "rive/animation/state_machine_input_instance.hpp"
 #include "rive/animation/state_transition.hpp"
 #include "rive/importers/state_transition_importer.hpp"
 #include "rive/importers/state_machine_importer.hpp"
@@ -36,3 +39,71 @@ StatusCode TransitionCondition::import(ImportStack& importStack)
     transitionImporter->addCondition(this);
     return Super::import(importStack);
 }
+
+CompiledTransitionCondition CompiledTransitionCondition::compile(
+    const TransitionCondition* condition)
+{
+    CompiledTransitionCondition compiled = {Type::other,
+                                            TransitionConditionOp::equal,
+                                            condition->inputId(),
+                                            0.0f,
+                                            condition};
+    switch (condition->coreType())
+    {
+        case TransitionBoolCondition::typeKey:
+            compiled.type = Type::boolean;
+            compiled.op = condition->as<TransitionBoolCondition>()->op();
+            break;
+        case TransitionNumberCondition::typeKey:
+            compiled.type = Type::number;
+            compiled.op = condition->as<TransitionNumberCondition>()->op();
+            compiled.value = condition->as<TransitionNumberCondition>()->value();
+            break;
+        case TransitionTriggerCondition::typeKey:
+            compiled.type = Type::trigger;
+            break;
+    }
+    return compiled;
+}
+
+bool CompiledTransitionCondition::evaluate(const SMIInput* inputInstance) const
+{
+    if (inputInstance == nullptr)
+    {
+        return true;
+    }
+    switch (type)
+    {
+        case Type::boolean:
+        {
+            bool inputValue = static_cast<const SMIBool*>(inputInstance)->value();
+            return (inputValue && op == TransitionConditionOp::equal) ||
+                   (!inputValue && op == TransitionConditionOp::notEqual);
+        }
+        case Type::number:
+        {
+            float inputValue = static_cast<const SMINumber*>(inputInstance)->value();
+            switch (op)
+            {
+                case TransitionConditionOp::equal:
+                    return inputValue == value;
+                case TransitionConditionOp::notEqual:
+                    return inputValue != value;
+                case TransitionConditionOp::lessThanOrEqual:
+                    return inputValue <= value;
+                case TransitionConditionOp::lessThan:
+                    return inputValue < value;
+                case TransitionConditionOp::greaterThanOrEqual:
+                    return inputValue >= value;
+                case TransitionConditionOp::greaterThan:
+                    return inputValue > value;
+            }
+            return false;
+        }
+        case Type::trigger:
+            return static_cast<const SMITrigger*>(inputInstance)->m_Fired;
+        case Type::other:
+            break;
+    }
+    return condition->evaluate(inputInstance);
+}
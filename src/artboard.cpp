@@ -15,17 +15,81 @@
 #include "rive/importers/import_stack.hpp"
 #include "rive/importers/backboard_importer.hpp"
 #include "rive/nested_artboard.hpp"
+#include "rive/profiler.hpp"
 #include "rive/joystick.hpp"
 #include "rive/animation/state_machine_instance.hpp"
 #include "rive/shapes/shape.hpp"
+#include "rive/worker_pool.hpp"
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <stack>
 #include <unordered_map>
 
 using namespace rive;
 
+struct Artboard::ParallelUpdate
+{
+    /// Levels with fewer dirty components than this update on the calling
+    /// thread, and threads take this many components at a time.
+    static const size_t kMinBatch = 64;
+    static const size_t kGrain = 16;
+
+    Executor* executor = nullptr;
+    size_t threadCount = 0;
+    /// Graph orders of the components sorted by level, level i spanning
+    /// [levelEnds[i - 1], levelEnds[i]). Empty when the graph has a cycle.
+    std::vector<uint32_t> order;
+    std::vector<uint32_t> levelEnds;
+    /// Each component's level, by graph order.
+    std::vector<uint32_t> levels;
+
+    /// Whether updateDependencyLevels is running, the level it's on and
+    /// whether a component of that level or an earlier one got dirt since.
+    bool updating = false;
+    uint32_t level = 0;
+    bool reintroduced = false;
+
+    /// The dirty components of the level being updated, and their dirt.
+    std::vector<std::pair<Component*, ComponentDirt>> batch;
+
+    /// Dirt added while a level updates on several threads, one queue per
+    /// thread, applied in order once they've all finished.
+    struct DeferredDirt
+    {
+        enum class Kind : uint8_t
+        {
+            dirt,
+            recursiveDirt,
+            collapse,
+            expand,
+        };
+        Component* component;
+        ComponentDirt value;
+        Kind kind;
+    };
+    std::vector<std::vector<DeferredDirt>> deferred;
+};
+
+/// Which of ParallelUpdate::deferred the calling thread queues dirt in.
+static thread_local size_t sDeferredDirtQueue = 0;
+
+Artboard::Artboard() {}
+
+#ifdef TESTING
+Artboard::Artboard(Factory* factory) : m_Factory(factory) {}
+#endif
+
+void* Artboard::operator new(size_t size) { return ::operator new(size); }
+
+void Artboard::operator delete(void* ptr, size_t size) { ::operator delete(ptr); }
+
 Artboard::~Artboard()
 {
+    // Objects go back to the allocator they were cloned from (or the heap,
+    // for source artboards).
+    AllocatorScope scope(m_Allocator.get());
     for (auto object : m_Objects)
     {
         // First object is artboard
@@ -53,6 +117,10 @@ Artboard::~Artboard()
     }
 }
 
+// Flags an entry in m_DependencyOrderIndices as the path composer of the
+// shape at that index.
+static const uint32_t kPathComposerIndex = 1u << 31;
+
 static bool canContinue(StatusCode code)
 {
     // We currently only cease loading on invalid object.
@@ -83,6 +151,9 @@ StatusCode Artboard::initialize()
         }
     }
 
+    // Parents now know their children.
+    buildHierarchy();
+
     // Animations and StateMachines initialize only once on the source/origin
     // Artboard. Instances will hold references to the original Animations and StateMachines, so
     // running this code for instances will effectively initialize them twice. This can lead to
@@ -107,6 +178,15 @@ StatusCode Artboard::initialize()
         }
     }
 
+    // Instances share the sorted graph and draw order computed by their
+    // source artboard, we only need to remap those by object index.
+    const Artboard* source = isInstance() ? m_Source : nullptr;
+    if (source != nullptr && source->m_DependencyOrderIndices.empty())
+    {
+        // The source didn't finish initializing, sort from scratch.
+        source = nullptr;
+    }
+
     // Store a map of the drawRules to make it easier to lookup the matching
     // rule for a transform component.
     std::unordered_map<Core*, DrawRules*> componentDrawRules;
@@ -130,6 +210,10 @@ StatusCode Artboard::initialize()
         {
             case DrawRulesBase::typeKey:
             {
+                if (source != nullptr)
+                {
+                    break;
+                }
                 DrawRules* rules = static_cast<DrawRules*>(object);
                 Core* component = resolve(rules->parentId());
                 if (component != nullptr)
@@ -196,21 +280,54 @@ StatusCode Artboard::initialize()
         if (object->is<Drawable>())
         {
             Drawable* drawable = object->as<Drawable>();
-            m_Drawables.push_back(drawable);
-
-            for (ContainerComponent* parent = drawable; parent != nullptr;
-                 parent = parent->parent())
+            if (source != nullptr)
+            {
+                uint32_t rulesIndex = source->m_DrawRulesIndices[m_Drawables.size()];
+                drawable->flattenedDrawRules =
+                    rulesIndex == 0 ? nullptr : m_Objects[rulesIndex]->as<DrawRules>();
+            }
+            else
             {
-                auto itr = componentDrawRules.find(parent);
-                if (itr != componentDrawRules.end())
+                for (ContainerComponent* parent = drawable; parent != nullptr;
+                     parent = parent->parent())
                 {
-                    drawable->flattenedDrawRules = itr->second;
-                    break;
+                    auto itr = componentDrawRules.find(parent);
+                    if (itr != componentDrawRules.end())
+                    {
+                        drawable->flattenedDrawRules = itr->second;
+                        break;
+                    }
                 }
             }
+            m_Drawables.push_back(drawable);
         }
     }
 
+    if (source != nullptr)
+    {
+        m_DependencyOrder.reserve(source->m_DependencyOrderIndices.size());
+        for (auto index : source->m_DependencyOrderIndices)
+        {
+            if ((index & kPathComposerIndex) != 0)
+            {
+                auto shape = m_Objects[index & ~kPathComposerIndex]->as<Shape>();
+                m_DependencyOrder.push_back(shape->pathComposer());
+            }
+            else
+            {
+                m_DependencyOrder.push_back(m_Objects[index]->as<Component>());
+            }
+        }
+        assignGraphOrder();
+
+        m_DrawTargets.reserve(source->m_DrawTargetIndices.size());
+        for (auto index : source->m_DrawTargetIndices)
+        {
+            m_DrawTargets.push_back(m_Objects[index]->as<DrawTarget>());
+        }
+        return StatusCode::Ok;
+    }
+
     sortDependencies();
 
     DrawTarget root;
@@ -233,15 +350,11 @@ StatusCode Artboard::initialize()
                 // Because we don't store targets on rules, we need
                 // to find the targets that belong to this rule
                 // here.
-                for (auto object2 : m_Objects)
+                for (auto child : dependentRules->children())
                 {
-                    if (object2 != nullptr && object2->is<DrawTarget>())
+                    if (child->is<DrawTarget>())
                     {
-                        DrawTarget* dependentTarget = object2->as<DrawTarget>();
-                        if (dependentTarget->parent() == dependentRules)
-                        {
-                            dependentTarget->addDependent(target);
-                        }
+                        child->addDependent(target);
                     }
                 }
             }
@@ -257,6 +370,50 @@ StatusCode Artboard::initialize()
         m_DrawTargets.push_back(static_cast<DrawTarget*>(*itr++));
     }
 
+    // Record everything we sorted by object index so that instances can skip
+    // sorting. Path composers aren't in m_Objects, they're referenced via
+    // their shape's index.
+    std::unordered_map<const Core*, uint32_t> objectIndices;
+    objectIndices.reserve(m_Objects.size());
+    for (size_t i = 0; i < m_Objects.size(); i++)
+    {
+        auto object = m_Objects[i];
+        if (object == nullptr)
+        {
+            continue;
+        }
+        objectIndices[object] = (uint32_t)i;
+        if (object->is<Shape>())
+        {
+            objectIndices[object->as<Shape>()->pathComposer()] = (uint32_t)i | kPathComposerIndex;
+        }
+    }
+    std::vector<uint32_t> dependencyOrderIndices;
+    dependencyOrderIndices.reserve(m_DependencyOrder.size());
+    for (auto component : m_DependencyOrder)
+    {
+        auto itr = objectIndices.find(component);
+        if (itr == objectIndices.end())
+        {
+            // Something we can't remap by index, let instances sort.
+            return StatusCode::Ok;
+        }
+        dependencyOrderIndices.push_back(itr->second);
+    }
+    m_DrawRulesIndices.reserve(m_Drawables.size());
+    for (auto drawable : m_Drawables)
+    {
+        m_DrawRulesIndices.push_back(
+            drawable->flattenedDrawRules == nullptr ? 0 : objectIndices[drawable->flattenedDrawRules]);
+    }
+    m_DrawTargetIndices.reserve(m_DrawTargets.size());
+    for (auto target : m_DrawTargets)
+    {
+        m_DrawTargetIndices.push_back(objectIndices[target]);
+    }
+    // Assigned last, instances only use the indices once this is populated.
+    m_DependencyOrderIndices = std::move(dependencyOrderIndices);
+
     return StatusCode::Ok;
 }
 
@@ -354,16 +511,161 @@ void Artboard::sortDependencies()
 {
     DependencySorter sorter;
     sorter.sort(this, m_DependencyOrder);
+    assignGraphOrder();
+}
+
+void Artboard::assignGraphOrder()
+{
     unsigned int graphOrder = 0;
     for (auto component : m_DependencyOrder)
     {
         component->m_GraphOrder = graphOrder++;
     }
+
+    // Components start out filthy, so the first update visits all of them.
+    m_DirtyComponents.assign((m_DependencyOrder.size() + 63) / 64, ~uint64_t(0));
+    if (auto tail = m_DependencyOrder.size() % 64)
+    {
+        m_DirtyComponents.back() = (uint64_t(1) << tail) - 1;
+    }
     m_Dirt |= ComponentDirt::Components;
+
+    m_WorldTransformPass.build(m_DependencyOrder);
+    if (m_ParallelUpdate != nullptr)
+    {
+        buildDependencyLevels();
+    }
+}
+
+static inline unsigned int countTrailingZeros(uint64_t word)
+{
+    assert(word != 0);
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#else
+    unsigned int count = 0;
+    while ((word & 1) == 0)
+    {
+        word >>= 1;
+        count++;
+    }
+    return count;
+#endif
+}
+
+/// Returns the graph order of the first dirty component at or after
+/// graphOrder, or m_DependencyOrder.size() if there are none.
+size_t Artboard::nextDirtyComponent(size_t graphOrder) const
+{
+    size_t wordIndex = graphOrder / 64;
+    if (wordIndex >= m_DirtyComponents.size())
+    {
+        return m_DependencyOrder.size();
+    }
+    // Mask off the bits before graphOrder in the first word.
+    uint64_t word = m_DirtyComponents[wordIndex] & (~uint64_t(0) << (graphOrder % 64));
+    while (word == 0)
+    {
+        if (++wordIndex == m_DirtyComponents.size())
+        {
+            return m_DependencyOrder.size();
+        }
+        word = m_DirtyComponents[wordIndex];
+    }
+    return wordIndex * 64 + countTrailingZeros(word);
 }
 
 void Artboard::addObject(Core* object) { m_Objects.push_back(object); }
 
+void Artboard::buildHierarchy()
+{
+    const uint32_t none = std::numeric_limits<uint32_t>::max();
+    m_Hierarchy.clear();
+    m_Hierarchy.reserve(m_Objects.size());
+    m_HierarchyEnds.clear();
+    m_HierarchyEnds.reserve(m_Objects.size());
+
+    // Components hold their id while we walk down from the roots (the
+    // artboard, and components whose parent didn't resolve).
+    for (size_t i = 0; i < m_Objects.size(); i++)
+    {
+        auto object = m_Objects[i];
+        if (object != nullptr && object->is<Component>())
+        {
+            object->as<Component>()->m_HierarchyOrder = (uint32_t)i;
+        }
+    }
+    struct Visit
+    {
+        const Component* component;
+        uint32_t order;
+        uint32_t nextChild;
+    };
+    std::vector<Visit> stack;
+    for (auto object : m_Objects)
+    {
+        if (object == nullptr || !object->is<Component>() ||
+            object->as<Component>()->parent() != nullptr)
+        {
+            continue;
+        }
+        auto root = object->as<Component>();
+        stack.push_back({root, (uint32_t)m_Hierarchy.size(), 0});
+        m_Hierarchy.push_back(root->m_HierarchyOrder);
+        m_HierarchyEnds.push_back(0);
+        while (!stack.empty())
+        {
+            Visit& visit = stack.back();
+            const Component* component = visit.component;
+            if (component->is<ContainerComponent>())
+            {
+                auto& children = component->as<ContainerComponent>()->children();
+                if (visit.nextChild < children.size())
+                {
+                    auto child = children[visit.nextChild++];
+                    if (child->m_HierarchyOrder == none)
+                    {
+                        // Not one of our objects (like the path composers
+                        // shapes parent to the artboard).
+                        continue;
+                    }
+                    stack.push_back({child, (uint32_t)m_Hierarchy.size(), 0});
+                    m_Hierarchy.push_back(child->m_HierarchyOrder);
+                    m_HierarchyEnds.push_back(0);
+                    continue;
+                }
+            }
+            m_HierarchyEnds[visit.order] = (uint32_t)m_Hierarchy.size();
+            stack.pop_back();
+        }
+    }
+
+    // Now swap the ids for positions in the hierarchy.
+    for (auto object : m_Objects)
+    {
+        if (object != nullptr && object->is<Component>())
+        {
+            object->as<Component>()->m_HierarchyOrder = none;
+        }
+    }
+    for (size_t i = 0; i < m_Hierarchy.size(); i++)
+    {
+        m_Objects[m_Hierarchy[i]]->as<Component>()->m_HierarchyOrder = (uint32_t)i;
+    }
+}
+
+void Artboard::subtreeIds(const Component* component, std::vector<uint32_t>& ids) const
+{
+    uint32_t order = component->m_HierarchyOrder;
+    if (order >= m_Hierarchy.size() || m_Objects[m_Hierarchy[order]] != component)
+    {
+        return;
+    }
+    size_t start = ids.size();
+    ids.insert(ids.end(), m_Hierarchy.begin() + order, m_Hierarchy.begin() + m_HierarchyEnds[order]);
+    std::sort(ids.begin() + start, ids.end());
+}
+
 void Artboard::addAnimation(LinearAnimation* object) { m_Animations.push_back(object); }
 
 void Artboard::addStateMachine(StateMachine* object) { m_StateMachines.push_back(object); }
@@ -395,12 +697,31 @@ void Artboard::onComponentDirty(Component* component)
 {
     m_Dirt |= ComponentDirt::Components;
 
+    unsigned int graphOrder = component->graphOrder();
+    if (graphOrder >= m_DependencyOrder.size())
+    {
+        // Not sorted (yet), sortDependencies will schedule it.
+        return;
+    }
+    m_DirtyComponents[graphOrder / 64] |= uint64_t(1) << (graphOrder % 64);
+    if ((component->m_Dirt & (ComponentDirt::Transform | ComponentDirt::WorldTransform)) !=
+        ComponentDirt::None)
+    {
+        m_WorldTransformPass.markDirty(graphOrder);
+    }
+
+    if (m_ParallelUpdate != nullptr && m_ParallelUpdate->updating &&
+        m_ParallelUpdate->levels[graphOrder] <= m_ParallelUpdate->level)
+    {
+        m_ParallelUpdate->reintroduced = true;
+    }
+
     /// If the order of the component is less than the current dirt
     /// depth, update the dirt depth so that the update loop can break
     /// out early and re-run (something up the tree is dirty).
-    if (component->graphOrder() < m_DirtDepth)
+    if (graphOrder < m_DirtDepth)
     {
-        m_DirtDepth = component->graphOrder();
+        m_DirtDepth = graphOrder;
     }
 }
 
@@ -429,23 +750,256 @@ void Artboard::update(ComponentDirt value)
     }
 }
 
+void Artboard::updateInParallel(Executor* executor, size_t threadCount)
+{
+    if (executor == nullptr || threadCount < 2)
+    {
+        m_ParallelUpdate.reset();
+        return;
+    }
+    if (m_ParallelUpdate == nullptr)
+    {
+        m_ParallelUpdate.reset(new ParallelUpdate());
+    }
+    m_ParallelUpdate->executor = executor;
+    m_ParallelUpdate->threadCount = threadCount;
+    buildDependencyLevels();
+}
+
+void Artboard::buildDependencyLevels()
+{
+    auto& parallel = *m_ParallelUpdate;
+    size_t count = m_DependencyOrder.size();
+    parallel.order.clear();
+    parallel.levelEnds.clear();
+    parallel.levels.assign(count, 0);
+
+    // A component's level is one more than the highest of the components it
+    // depends on, which all come before it in graph order.
+    uint32_t levelCount = count == 0 ? 0 : 1;
+    for (size_t i = 0; i < count; i++)
+    {
+        uint32_t next = parallel.levels[i] + 1;
+        for (auto dependent : m_DependencyOrder[i]->dependents())
+        {
+            size_t order = dependent->graphOrder();
+            if (order >= count)
+            {
+                continue;
+            }
+            if (order <= i)
+            {
+                // A cycle the sorter had to break, only the serial loop
+                // handles it.
+                parallel.levels.clear();
+                return;
+            }
+            parallel.levels[order] = std::max(parallel.levels[order], next);
+            levelCount = std::max(levelCount, next + 1);
+        }
+    }
+
+    // Group by level, keeping graph order within each level.
+    std::vector<uint32_t> starts(levelCount, 0);
+    for (auto level : parallel.levels)
+    {
+        starts[level]++;
+    }
+    uint32_t start = 0;
+    for (auto& levelStart : starts)
+    {
+        uint32_t size = levelStart;
+        levelStart = start;
+        start += size;
+        parallel.levelEnds.push_back(start);
+    }
+    parallel.order.resize(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        parallel.order[starts[parallel.levels[i]]++] = (uint32_t)i;
+    }
+}
+
+/// Updates the dirty components a level at a time, spreading wide levels
+/// across threads. Returns false if it stopped because something dirtied a
+/// component of the level it was on or an earlier one, leaving the rest to
+/// the serial loop. Components of a level only see the dirt they added each
+/// other once the level's done, so they never race on it.
+bool Artboard::updateDependencyLevels()
+{
+    auto& parallel = *m_ParallelUpdate;
+    if (parallel.levelEnds.empty())
+    {
+        return false;
+    }
+    parallel.updating = true;
+    parallel.reintroduced = false;
+    uint32_t levelStart = 0;
+    for (uint32_t level = 0; level < parallel.levelEnds.size(); level++)
+    {
+        parallel.level = level;
+        auto& batch = parallel.batch;
+        batch.clear();
+        for (uint32_t i = levelStart; i < parallel.levelEnds[level]; i++)
+        {
+            uint32_t graphOrder = parallel.order[i];
+            uint64_t bit = uint64_t(1) << (graphOrder % 64);
+            if ((m_DirtyComponents[graphOrder / 64] & bit) == 0)
+            {
+                continue;
+            }
+            m_DirtyComponents[graphOrder / 64] &= ~bit;
+            auto component = m_DependencyOrder[graphOrder];
+            auto d = component->m_Dirt;
+            if (d == ComponentDirt::None ||
+                (d & ComponentDirt::Collapsed) == ComponentDirt::Collapsed)
+            {
+                continue;
+            }
+            component->m_Dirt &= ComponentDirt::Collapsed;
+            batch.push_back({component, d});
+        }
+        levelStart = parallel.levelEnds[level];
+
+        if (batch.size() < ParallelUpdate::kMinBatch)
+        {
+            for (auto& entry : batch)
+            {
+                RIVE_PROFILE_COMPONENT_UPDATE(entry.second);
+                entry.first->update(entry.second);
+            }
+        }
+        else
+        {
+            size_t size = batch.size();
+            std::atomic<size_t> next(0);
+            auto work = [&batch, &next, size](size_t queue) {
+                size_t previousQueue = sDeferredDirtQueue;
+                sDeferredDirtQueue = queue;
+                size_t i;
+                while ((i = next.fetch_add(ParallelUpdate::kGrain)) < size)
+                {
+                    size_t end = std::min(i + ParallelUpdate::kGrain, size);
+                    for (; i < end; i++)
+                    {
+                        RIVE_PROFILE_COMPONENT_UPDATE(batch[i].second);
+                        batch[i].first->update(batch[i].second);
+                    }
+                }
+                sDeferredDirtQueue = previousQueue;
+            };
+
+            size_t jobCount =
+                std::min(parallel.threadCount,
+                         (size + ParallelUpdate::kGrain - 1) / ParallelUpdate::kGrain);
+            std::mutex mutex;
+            std::condition_variable finished;
+            size_t running = jobCount - 1;
+            if (parallel.deferred.size() < jobCount)
+            {
+                parallel.deferred.resize(jobCount);
+            }
+            m_DeferredDirt = &parallel;
+            for (size_t i = 1; i < jobCount; i++)
+            {
+                parallel.executor->execute([&work, &mutex, &finished, &running, i]() {
+                    work(i);
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (--running == 0)
+                    {
+                        finished.notify_one();
+                    }
+                });
+            }
+            work(0);
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                finished.wait(lock, [&running] { return running == 0; });
+            }
+            m_DeferredDirt = nullptr;
+
+            // Now that nothing's updating, apply the dirt the level added. Any
+            // that lands on this level or an earlier one reintroduces it.
+            for (size_t i = 0; i < jobCount; i++)
+            {
+                for (auto& entry : parallel.deferred[i])
+                {
+                    switch (entry.kind)
+                    {
+                        case ParallelUpdate::DeferredDirt::Kind::dirt:
+                            entry.component->addDirt(entry.value, false);
+                            break;
+                        case ParallelUpdate::DeferredDirt::Kind::recursiveDirt:
+                            entry.component->addDirt(entry.value, true);
+                            break;
+                        // Overrides of collapse already passed it on (to
+                        // their own deferred queue), only the component's
+                        // own state is left.
+                        case ParallelUpdate::DeferredDirt::Kind::collapse:
+                            entry.component->Component::collapse(true);
+                            break;
+                        case ParallelUpdate::DeferredDirt::Kind::expand:
+                            entry.component->Component::collapse(false);
+                            break;
+                    }
+                }
+                parallel.deferred[i].clear();
+            }
+        }
+
+        if (parallel.reintroduced)
+        {
+            parallel.updating = false;
+            return false;
+        }
+    }
+    parallel.updating = false;
+    return true;
+}
+
+void Artboard::deferDirt(Component* component, ComponentDirt value, bool recurse)
+{
+    m_DeferredDirt->deferred[sDeferredDirtQueue].push_back(
+        {component,
+         value,
+         recurse ? ParallelUpdate::DeferredDirt::Kind::recursiveDirt
+                 : ParallelUpdate::DeferredDirt::Kind::dirt});
+}
+
+void Artboard::deferCollapse(Component* component, bool value)
+{
+    m_DeferredDirt->deferred[sDeferredDirtQueue].push_back(
+        {component,
+         ComponentDirt::Collapsed,
+         value ? ParallelUpdate::DeferredDirt::Kind::collapse
+               : ParallelUpdate::DeferredDirt::Kind::expand});
+}
+
 bool Artboard::updateComponents()
 {
     if (hasDirt(ComponentDirt::Components))
     {
+        RIVE_PROFILE_SCOPE(updateComponents);
         const int maxSteps = 100;
         int step = 0;
         auto count = m_DependencyOrder.size();
         while (hasDirt(ComponentDirt::Components) && step < maxSteps)
         {
             m_Dirt = m_Dirt & ~ComponentDirt::Components;
+            m_WorldTransformPass.update(m_DirtyComponents);
+            if (m_ParallelUpdate != nullptr && updateDependencyLevels())
+            {
+                step++;
+                continue;
+            }
 
-            // Track dirt depth here so that if something else marks
-            // dirty, we restart.
-            for (unsigned int i = 0; i < count; i++)
+            // Only visit the components that were marked dirty. Track dirt
+            // depth here so that if something else marks dirty, we restart.
+            for (size_t i = nextDirtyComponent(0); i < count; i = nextDirtyComponent(i + 1))
             {
                 auto component = m_DependencyOrder[i];
-                m_DirtDepth = i;
+                m_DirtyComponents[i / 64] &= ~(uint64_t(1) << (i % 64));
+                m_DirtDepth = (unsigned int)i;
                 auto d = component->m_Dirt;
                 if (d == ComponentDirt::None ||
                     (d & ComponentDirt::Collapsed) == ComponentDirt::Collapsed)
@@ -453,6 +1007,7 @@ bool Artboard::updateComponents()
                     continue;
                 }
                 component->m_Dirt &= ComponentDirt::Collapsed;
+                RIVE_PROFILE_COMPONENT_UPDATE(d);
                 component->update(d);
 
                 // If the update changed the dirt depth by adding dirt
@@ -472,6 +1027,7 @@ bool Artboard::updateComponents()
 
 bool Artboard::advance(double elapsedSeconds)
 {
+    RIVE_PROFILE_SCOPE(advance);
     if (m_JoysticksApplyBeforeUpdate)
     {
         for (auto joystick : m_Joysticks)
@@ -550,6 +1106,7 @@ Core* Artboard::hitTest(HitInfo* hinfo, const Mat2D* xform)
 
 void Artboard::draw(Renderer* renderer, DrawOption option)
 {
+    RIVE_PROFILE_SCOPE(draw);
     renderer->save();
     if (clip())
     {
@@ -653,16 +1210,38 @@ std::string Artboard::stateMachineNameAt(size_t index) const
     return sm ? sm->name() : nullptr;
 }
 
-LinearAnimation* Artboard::animation(const std::string& name) const
+const NameIndex& Artboard::objectNames() const
 {
-    for (auto animation : m_Animations)
-    {
-        if (animation->name() == name)
-        {
-            return animation;
-        }
-    }
-    return nullptr;
+    const Artboard* source = this->source();
+    const std::vector<Core*>& objects = source->m_Objects;
+    source->m_ObjectNames.buildOnce(objects.size(), [&](size_t i) -> const std::string* {
+        Core* object = objects[i];
+        return object != nullptr && object->is<Component>() ? &object->as<Component>()->name()
+                                                            : nullptr;
+    });
+    return source->m_ObjectNames;
+}
+
+const TypeIndex& Artboard::objectTypes() const
+{
+    const Artboard* source = this->source();
+    const std::vector<Core*>& objects = source->m_Objects;
+    source->m_ObjectTypes.buildOnce(objects.size(), [&](size_t i) -> uint16_t {
+        return objects[i] == nullptr ? 0 : objects[i]->coreType();
+    });
+    return source->m_ObjectTypes;
+}
+
+LinearAnimation* Artboard::animation(StringView name) const
+{
+    const Artboard* source = this->source();
+    source->m_AnimationNames.buildOnce(source->m_Animations.size(), [&](size_t i) {
+        return &source->m_Animations[i]->name();
+    });
+    size_t index = source->m_AnimationNames.find(
+        name,
+        [&](size_t i) { return name == m_Animations[i]->name(); });
+    return index == NameIndex::npos ? nullptr : m_Animations[index];
 }
 
 LinearAnimation* Artboard::animation(size_t index) const
@@ -674,16 +1253,16 @@ LinearAnimation* Artboard::animation(size_t index) const
     return m_Animations[index];
 }
 
-StateMachine* Artboard::stateMachine(const std::string& name) const
+StateMachine* Artboard::stateMachine(StringView name) const
 {
-    for (auto machine : m_StateMachines)
-    {
-        if (machine->name() == name)
-        {
-            return machine;
-        }
-    }
-    return nullptr;
+    const Artboard* source = this->source();
+    source->m_StateMachineNames.buildOnce(source->m_StateMachines.size(), [&](size_t i) {
+        return &source->m_StateMachines[i]->name();
+    });
+    size_t index = source->m_StateMachineNames.find(
+        name,
+        [&](size_t i) { return name == m_StateMachines[i]->name(); });
+    return index == NameIndex::npos ? nullptr : m_StateMachines[index];
 }
 
 StateMachine* Artboard::stateMachine(size_t index) const
@@ -792,24 +1371,44 @@ std::unique_ptr<LinearAnimationInstance> ArtboardInstance::animationAt(size_t in
     return la ? rivestd::make_unique<LinearAnimationInstance>(la, this) : nullptr;
 }
 
-std::unique_ptr<LinearAnimationInstance> ArtboardInstance::animationNamed(const std::string& name)
+std::unique_ptr<LinearAnimationInstance> ArtboardInstance::animationNamed(StringView name)
 {
     auto la = this->animation(name);
     return la ? rivestd::make_unique<LinearAnimationInstance>(la, this) : nullptr;
 }
 
+std::unique_ptr<LinearAnimationInstance> ArtboardInstance::animationNamed(const std::string& name)
+{
+    return animationNamed(StringView(name));
+}
+
+std::unique_ptr<LinearAnimationInstance> ArtboardInstance::animationNamed(const char* name)
+{
+    return animationNamed(StringView(name));
+}
+
 std::unique_ptr<StateMachineInstance> ArtboardInstance::stateMachineAt(size_t index)
 {
     auto sm = this->stateMachine(index);
     return sm ? rivestd::make_unique<StateMachineInstance>(sm, this) : nullptr;
 }
 
-std::unique_ptr<StateMachineInstance> ArtboardInstance::stateMachineNamed(const std::string& name)
+std::unique_ptr<StateMachineInstance> ArtboardInstance::stateMachineNamed(StringView name)
 {
     auto sm = this->stateMachine(name);
     return sm ? rivestd::make_unique<StateMachineInstance>(sm, this) : nullptr;
 }
 
+std::unique_ptr<StateMachineInstance> ArtboardInstance::stateMachineNamed(const std::string& name)
+{
+    return stateMachineNamed(StringView(name));
+}
+
+std::unique_ptr<StateMachineInstance> ArtboardInstance::stateMachineNamed(const char* name)
+{
+    return stateMachineNamed(StringView(name));
+}
+
 std::unique_ptr<StateMachineInstance> ArtboardInstance::defaultStateMachine()
 {
     const int index = this->defaultStateMachineIndex();
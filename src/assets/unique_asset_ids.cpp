@@ -0,0 +1,17 @@
+#include "rive/assets/unique_asset_ids.hpp"
+
+using namespace rive;
+
+uint32_t UniqueAssetIds::add(uint32_t id)
+{
+    if (m_Ids.count(id))
+    {
+        id = m_NextId;
+    }
+    m_Ids.insert(id);
+    if (id >= m_NextId)
+    {
+        m_NextId = id + 1;
+    }
+    return id;
+}
@@ -43,6 +43,13 @@ bool Component::addDirt(ComponentDirt value, bool recurse)
         // Already marked.
         return false;
     }
+    if (m_Artboard->m_DeferredDirt != nullptr)
+    {
+        // A level is updating on several threads, the artboard applies this
+        // once it's done (see Artboard::updateInParallel).
+        m_Artboard->deferDirt(this, value, recurse);
+        return true;
+    }
 
     // Make sure dirt is set before calling anything that can set more dirt.
     m_Dirt |= value;
@@ -88,6 +95,11 @@ bool Component::collapse(bool value)
     {
         return false;
     }
+    if (m_Artboard->m_DeferredDirt != nullptr)
+    {
+        m_Artboard->deferCollapse(this, value);
+        return true;
+    }
     if (value)
     {
         m_Dirt |= ComponentDirt::Collapsed;
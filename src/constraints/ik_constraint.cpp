@@ -56,26 +56,15 @@ StatusCode IKConstraint::onAddedClean(CoreContext* context)
     // tip (constrainedComponent).
     auto tip = parent()->as<Bone>();
 
-    auto artboard = static_cast<Artboard*>(context);
-
-    // Find all children of this bone (we don't directly build up
-    // hierarchy at runtime, so we have to traverse everything and check
-    // parents).
-    for (auto core : artboard->objects())
+    // Find all children of the bones up the chain, other than the next bone
+    // in the chain (bones is ordered from the tip up).
+    for (int i = 1; i < numBones; i++)
     {
-        if (core == nullptr || !core->is<TransformComponent>())
-        {
-            continue;
-        }
-        auto transformComponent = core->as<TransformComponent>();
-
-        for (int i = 1; i < numBones; i++)
+        for (auto child : bones[i]->children())
         {
-            auto childBone = bones[i];
-            if (transformComponent->parent() == childBone &&
-                std::find(bones.begin(), bones.end(), transformComponent) == bones.end())
+            if (child->is<TransformComponent>() && child != bones[i - 1])
             {
-                tip->addDependent(transformComponent);
+                tip->addDependent(child);
             }
         }
     }
@@ -1,7 +1,6 @@
 #include "rive/core/binary_reader.hpp"
 #include "rive/core/reader.h"
 #include "rive/span.hpp"
-#include <vector>
 
 using namespace rive;
 
@@ -33,7 +32,7 @@ void BinaryReader::intRangeError()
     m_Position = m_Bytes.end();
 }
 
-uint64_t BinaryReader::readVarUint64()
+uint64_t BinaryReader::decodeVarUint64()
 {
     uint64_t value;
     auto readBytes = decode_uint_leb(m_Position, m_Bytes.end(), &value);
@@ -48,21 +47,9 @@ uint64_t BinaryReader::readVarUint64()
 
 std::string BinaryReader::readString()
 {
-    uint64_t length = readVarUint64();
-    if (didOverflow())
-    {
-        return std::string();
-    }
-
-    std::vector<char> rawValue((size_t)length + 1);
-    auto readBytes = decode_string(length, m_Position, m_Bytes.end(), &rawValue[0]);
-    if (readBytes != length)
-    {
-        overflow();
-        return std::string();
-    }
-    m_Position += readBytes;
-    return std::string(rawValue.data(), (size_t)length);
+    // Build the string straight from the bytes being read.
+    auto bytes = readBytes();
+    return std::string((const char*)bytes.data(), bytes.size());
 }
 
 Span<const uint8_t> BinaryReader::readBytes()
@@ -72,6 +59,11 @@ Span<const uint8_t> BinaryReader::readBytes()
     {
         return Span<const uint8_t>(m_Position, 0);
     }
+    if (length > (uint64_t)(m_Bytes.end() - m_Position))
+    {
+        overflow();
+        return Span<const uint8_t>(m_Position, 0);
+    }
 
     const uint8_t* start = m_Position;
     m_Position += length;
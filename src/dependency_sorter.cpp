@@ -1,5 +1,6 @@
 #include "rive/dependency_sorter.hpp"
 #include "rive/component.hpp"
+#include <algorithm>
 
 using namespace rive;
 
@@ -7,6 +8,9 @@ void DependencySorter::sort(Component* root, std::vector<Component*>& order)
 {
     order.clear();
     visit(root, order);
+    // Components are appended once all their dependents have been visited,
+    // so the dependency order is the reverse of that.
+    std::reverse(order.begin(), order.end());
 }
 
 bool DependencySorter::visit(Component* component, std::vector<Component*>& order)
@@ -32,7 +36,7 @@ bool DependencySorter::visit(Component* component, std::vector<Component*>& orde
         }
     }
     m_Perm.emplace(component);
-    order.insert(order.begin(), component);
+    order.push_back(component);
 
     return true;
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "rive/file.hpp"
+#include "rive/profiler.hpp"
 #include "rive/rive_counter.hpp"
 #include "rive/runtime_header.hpp"
 #include "rive/animation/animation.hpp"
@@ -28,6 +29,11 @@
 #include "rive/animation/blend_state_direct.hpp"
 #include "rive/assets/file_asset.hpp"
 #include "rive/assets/file_asset_contents.hpp"
+#include "rive/assets/folder.hpp"
+#include "rive/assets/font_asset.hpp"
+#include "rive/assets/image_asset.hpp"
+#include <condition_variable>
+#include <mutex>
 
 // Default namespace for Rive Cpp code
 using namespace rive;
@@ -120,6 +126,115 @@ static Core* readRuntimeObject(BinaryReader& reader, const RuntimeHeader& header
     return object;
 }
 
+// Skip a single Rive runtime object without making it, returns its core type
+// or -1 if it can't be read.
+static int skipRuntimeObject(BinaryReader& reader, const RuntimeHeader& header)
+{
+    auto coreObjectKey = reader.readVarUintAs<int>();
+    while (true)
+    {
+        auto propertyKey = reader.readVarUintAs<uint16_t>();
+        if (propertyKey == 0)
+        {
+            break;
+        }
+        if (reader.hasError())
+        {
+            return -1;
+        }
+        int id = CoreRegistry::propertyFieldId(propertyKey);
+        if (id == -1)
+        {
+            id = header.propertyFieldId(propertyKey);
+        }
+        switch (id)
+        {
+            case CoreUintType::id:
+                CoreUintType::deserialize(reader);
+                break;
+            case CoreStringType::id:
+                // Strings and bytes are both length prefixed.
+                reader.readBytes();
+                break;
+            case CoreDoubleType::id:
+                CoreDoubleType::deserialize(reader);
+                break;
+            case CoreColorType::id:
+                CoreColorType::deserialize(reader);
+                break;
+            default:
+                return -1;
+        }
+    }
+    return reader.hasError() ? -1 : coreObjectKey;
+}
+
+// Whether objects of this core type belong to the file rather than to the
+// artboard before them.
+static bool isFileObject(int coreType)
+{
+    switch (coreType)
+    {
+        case Backboard::typeKey:
+        case Artboard::typeKey:
+        case Folder::typeKey:
+        case ImageAsset::typeKey:
+        case FontAsset::typeKey:
+        case FileAssetContents::typeKey:
+            return true;
+    }
+    return false;
+}
+
+namespace
+{
+/// Collects the assets handed to it to load later.
+class CollectingAssetResolver : public FileAssetResolver
+{
+public:
+    std::vector<FileAsset*> assets;
+    void loadContents(FileAsset& asset) override { assets.push_back(&asset); }
+};
+} // namespace
+
+struct File::PendingAssets
+{
+    std::mutex mutex;
+    std::condition_variable loaded;
+    bool loading = true;
+};
+
+struct File::LazyImport
+{
+    enum class State : uint8_t
+    {
+        unread,
+        read,
+        failed,
+    };
+    struct LazyArtboard
+    {
+        State state = State::unread;
+        /// The artboard's objects, following the artboard itself in the
+        /// file. Either views of the imported bytes, when they outlive the
+        /// file, or of a copy of them.
+        std::vector<Span<const uint8_t>> segments;
+        std::vector<uint8_t> copy;
+    };
+
+    LazyImport(const RuntimeHeader& header, bool bytesOutliveFile) :
+        header(header), bytesOutliveFile(bytesOutliveFile)
+    {}
+
+    RuntimeHeader header;
+    bool bytesOutliveFile;
+    /// One per entry in m_Artboards.
+    std::vector<LazyArtboard> artboards;
+    /// The index in m_Artboards of each artboard in the file, by the id
+    /// nested artboards refer to them with, -1 for ones that failed to import.
+    std::vector<int> artboardIndices;
+};
+
 File::File(Factory* factory, FileAssetResolver* assetResolver) :
     m_Factory(factory), m_AssetResolver(assetResolver)
 {
@@ -128,13 +243,20 @@ File::File(Factory* factory, FileAssetResolver* assetResolver) :
     assert(factory);
 }
 
-File::~File() { Counter::update(Counter::kFile, -1); }
+File::~File()
+{
+    // The resolver may still be writing to the file's assets.
+    waitForAssets();
+    Counter::update(Counter::kFile, -1);
+}
 
 std::unique_ptr<File> File::import(Span<const uint8_t> bytes,
                                    Factory* factory,
                                    ImportResult* result,
-                                   FileAssetResolver* assetResolver)
+                                   FileAssetResolver* assetResolver,
+                                   const ImportOptions& options)
 {
+    RIVE_PROFILE_SCOPE(import);
     BinaryReader reader(bytes);
     RuntimeHeader header;
     if (!RuntimeHeader::read(reader, header))
@@ -161,7 +283,11 @@ std::unique_ptr<File> File::import(Span<const uint8_t> bytes,
         return nullptr;
     }
     auto file = std::unique_ptr<File>(new File(factory, assetResolver));
-    auto readResult = file->read(reader, header);
+    if (options.lazyArtboards)
+    {
+        file->m_LazyImport.reset(new LazyImport(header, options.bytesOutliveFile));
+    }
+    auto readResult = file->read(reader, header, options);
     if (readResult != ImportResult::success)
     {
         file.reset(nullptr);
@@ -173,11 +299,105 @@ std::unique_ptr<File> File::import(Span<const uint8_t> bytes,
     return file;
 }
 
-ImportResult File::read(BinaryReader& reader, const RuntimeHeader& header)
+ImportResult File::read(BinaryReader& reader,
+                        const RuntimeHeader& header,
+                        const ImportOptions& options)
+{
+    // Collect the assets the async resolver should load where they'd
+    // otherwise be handed to the file's resolver.
+    CollectingAssetResolver unresolvedAssets;
+    FileAssetResolver* assetResolver = m_AssetResolver;
+    if (options.asyncAssetResolver != nullptr)
+    {
+        m_AssetResolver = &unresolvedAssets;
+    }
+    ImportResult result = readAndResolve(reader, header, options.assetDecodeExecutor);
+    m_AssetResolver = assetResolver;
+
+    if (result == ImportResult::success && !unresolvedAssets.assets.empty())
+    {
+        auto pending = std::make_shared<PendingAssets>();
+        m_PendingAssets = pending;
+        options.asyncAssetResolver->loadContents(std::move(unresolvedAssets.assets), [pending]() {
+            std::lock_guard<std::mutex> lock(pending->mutex);
+            pending->loading = false;
+            pending->loaded.notify_all();
+        });
+    }
+    return result;
+}
+
+ImportResult File::readAndResolve(BinaryReader& reader,
+                                  const RuntimeHeader& header,
+                                  Executor* assetDecodeExecutor)
 {
     ImportStack importStack;
+    std::unique_ptr<AssetDecodeJobs> decodeJobs;
+    if (assetDecodeExecutor != nullptr)
+    {
+        decodeJobs.reset(new AssetDecodeJobs(assetDecodeExecutor, m_Factory));
+        m_AssetDecodeJobs = decodeJobs.get();
+    }
+    ImportResult result = readObjects(reader, header, importStack);
+    if (decodeJobs != nullptr)
+    {
+        // Assets are handed to what uses them when the stack resolves, so
+        // they have to be decoded by then.
+        for (auto asset : decodeJobs->wait())
+        {
+            if (m_AssetResolver != nullptr)
+            {
+                m_AssetResolver->loadContents(*asset);
+            }
+        }
+        m_AssetDecodeJobs = nullptr;
+    }
+    if (result != ImportResult::success)
+    {
+        return result;
+    }
+    return !reader.hasError() && importStack.resolve() == StatusCode::Ok ? ImportResult::success
+                                                                         : ImportResult::malformed;
+}
+
+ImportResult File::readObjects(BinaryReader& reader,
+                               const RuntimeHeader& header,
+                               ImportStack& importStack)
+{
+    // When importing lazily, the artboard the objects we skip belong to.
+    LazyImport::LazyArtboard* lazyArtboard = nullptr;
     while (!reader.reachedEnd())
     {
+        if (lazyArtboard != nullptr)
+        {
+            // Set aside the artboard's objects until it's asked for.
+            const uint8_t* from = reader.position();
+            while (!reader.reachedEnd())
+            {
+                BinaryReader peek = reader;
+                if (isFileObject(peek.readVarUintAs<int>()))
+                {
+                    break;
+                }
+                if (skipRuntimeObject(reader, header) == -1)
+                {
+                    return ImportResult::malformed;
+                }
+            }
+            if (m_LazyImport->bytesOutliveFile)
+            {
+                lazyArtboard->segments.push_back({from, (size_t)(reader.position() - from)});
+            }
+            else
+            {
+                lazyArtboard->copy.insert(lazyArtboard->copy.end(), from, reader.position());
+            }
+            if (reader.reachedEnd())
+            {
+                break;
+            }
+        }
+
         auto object = readRuntimeObject(reader, header);
         if (object == nullptr)
         {
@@ -196,6 +416,12 @@ ImportResult File::read(BinaryReader& reader, const RuntimeHeader& header)
                     Artboard* ab = object->as<Artboard>();
                     ab->m_Factory = m_Factory;
                     m_Artboards.push_back(std::unique_ptr<Artboard>(ab));
+                    if (m_LazyImport != nullptr)
+                    {
+                        m_LazyImport->artboardIndices.push_back((int)m_Artboards.size() - 1);
+                        m_LazyImport->artboards.emplace_back();
+                        lazyArtboard = &m_LazyImport->artboards.back();
+                    }
                 }
                 break;
                 case ImageAsset::typeKey:
@@ -210,6 +436,10 @@ ImportResult File::read(BinaryReader& reader, const RuntimeHeader& header)
         else
         {
             fprintf(stderr, "Failed to import object of type %d\n", object->coreType());
+            if (m_LazyImport != nullptr && object->is<Artboard>())
+            {
+                m_LazyImport->artboardIndices.push_back(-1);
+            }
             delete object;
             continue;
         }
@@ -222,6 +452,11 @@ ImportResult File::read(BinaryReader& reader, const RuntimeHeader& header)
                 stackObject = new BackboardImporter(object->as<Backboard>());
                 break;
             case Artboard::typeKey:
+                if (lazyArtboard != nullptr)
+                {
+                    // Its objects are imported when it's first asked for.
+                    break;
+                }
                 stackObject = new ArtboardImporter(object->as<Artboard>());
                 break;
             case LinearAnimation::typeKey:
@@ -278,7 +513,10 @@ ImportResult File::read(BinaryReader& reader, const RuntimeHeader& header)
             case ImageAsset::typeKey:
             case FontAsset::typeKey:
                 stackObject =
-                    new FileAssetImporter(object->as<FileAsset>(), m_AssetResolver, m_Factory);
+                    new FileAssetImporter(object->as<FileAsset>(),
+                                          m_AssetResolver,
+                                          m_Factory,
+                                          m_AssetDecodeJobs);
                 stackType = FileAsset::typeKey;
                 break;
         }
@@ -288,21 +526,100 @@ ImportResult File::read(BinaryReader& reader, const RuntimeHeader& header)
             return ImportResult::malformed;
         }
     }
-
-    return !reader.hasError() && importStack.resolve() == StatusCode::Ok ? ImportResult::success
-                                                                         : ImportResult::malformed;
+    return ImportResult::success;
 }
 
-Artboard* File::artboard(std::string name) const
+Artboard* File::loadArtboard(size_t index) const
 {
-    for (const auto& artboard : m_Artboards)
+    Artboard* artboard = m_Artboards[index].get();
+    if (m_LazyImport == nullptr)
     {
-        if (artboard->name() == name)
+        return artboard;
+    }
+    auto& lazyArtboard = m_LazyImport->artboards[index];
+    switch (lazyArtboard.state)
+    {
+        case LazyImport::State::read:
+            return artboard;
+        case LazyImport::State::failed:
+            return nullptr;
+        case LazyImport::State::unread:
+            break;
+    }
+
+    // Import the artboard's objects the same way File::read would have,
+    // with the file's assets available to them.
+    ImportStack importStack;
+    auto backboardImporter = new BackboardImporter(m_Backboard.get());
+    for (auto& asset : m_FileAssets)
+    {
+        backboardImporter->addFileAsset(asset.get());
+    }
+    importStack.makeLatest(Backboard::typeKey, backboardImporter);
+    importStack.makeLatest(Artboard::typeKey, new ArtboardImporter(artboard));
+
+    if (!m_LazyImport->bytesOutliveFile)
+    {
+        lazyArtboard.segments.push_back(lazyArtboard.copy);
+    }
+    // Reading the artboard's objects only adds to the artboard, never to
+    // the file.
+    File* file = const_cast<File*>(this);
+    bool read = true;
+    for (auto segment : lazyArtboard.segments)
+    {
+        BinaryReader reader(segment);
+        if (file->readObjects(reader, m_LazyImport->header, importStack) !=
+                ImportResult::success ||
+            reader.hasError())
         {
-            return artboard.get();
+            read = false;
+            break;
         }
     }
-    return nullptr;
+    read = read && importStack.resolve() == StatusCode::Ok;
+    std::vector<Span<const uint8_t>>().swap(lazyArtboard.segments);
+    std::vector<uint8_t>().swap(lazyArtboard.copy);
+    if (!read)
+    {
+        fprintf(stderr, "Failed to import artboard %s\n", artboard->name().c_str());
+        lazyArtboard.state = LazyImport::State::failed;
+        return nullptr;
+    }
+    lazyArtboard.state = LazyImport::State::read;
+
+    // Nested artboards refer to artboards that may not have been read yet.
+    // This one is read already so artboards nesting each other don't read
+    // forever.
+    for (auto nestedArtboard : artboard->nestedArtboards())
+    {
+        auto id = nestedArtboard->artboardId();
+        if (id < m_LazyImport->artboardIndices.size() && m_LazyImport->artboardIndices[id] != -1)
+        {
+            if (auto nested = loadArtboard(m_LazyImport->artboardIndices[id]))
+            {
+                nestedArtboard->nest(nested);
+            }
+        }
+    }
+    return artboard;
+}
+
+#ifdef TESTING
+bool File::isArtboardLoaded(size_t index) const
+{
+    return m_LazyImport == nullptr || index >= m_LazyImport->artboards.size() ||
+           m_LazyImport->artboards[index].state != LazyImport::State::unread;
+}
+#endif
+
+Artboard* File::artboard(StringView name) const
+{
+    m_ArtboardNames.buildOnce(m_Artboards.size(),
+                              [&](size_t i) { return &m_Artboards[i]->name(); });
+    size_t index =
+        m_ArtboardNames.find(name, [&](size_t i) { return name == m_Artboards[i]->name(); });
+    return index == NameIndex::npos ? nullptr : loadArtboard(index);
 }
 
 Artboard* File::artboard() const
@@ -311,7 +628,7 @@ Artboard* File::artboard() const
     {
         return nullptr;
     }
-    return m_Artboards[0].get();
+    return loadArtboard(0);
 }
 
 Artboard* File::artboard(size_t index) const
@@ -320,13 +637,13 @@ Artboard* File::artboard(size_t index) const
     {
         return nullptr;
     }
-    return m_Artboards[index].get();
+    return loadArtboard(index);
 }
 
 std::string File::artboardNameAt(size_t index) const
 {
-    auto ab = this->artboard(index);
-    return ab ? ab->name() : "";
+    // Artboards' names are known without reading them.
+    return index < m_Artboards.size() ? m_Artboards[index]->name() : "";
 }
 
 std::unique_ptr<ArtboardInstance> File::artboardDefault() const
@@ -341,12 +658,32 @@ std::unique_ptr<ArtboardInstance> File::artboardAt(size_t index) const
     return ab ? ab->instance() : nullptr;
 }
 
-std::unique_ptr<ArtboardInstance> File::artboardNamed(std::string name) const
+std::unique_ptr<ArtboardInstance> File::artboardNamed(StringView name) const
 {
     auto ab = this->artboard(name);
     return ab ? ab->instance() : nullptr;
 }
 
+bool File::assetsPending() const
+{
+    if (m_PendingAssets == nullptr)
+    {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(m_PendingAssets->mutex);
+    return m_PendingAssets->loading;
+}
+
+void File::waitForAssets() const
+{
+    if (m_PendingAssets == nullptr)
+    {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(m_PendingAssets->mutex);
+    m_PendingAssets->loaded.wait(lock, [this] { return !m_PendingAssets->loading; });
+}
+
 std::vector<const FileAsset*> File::assets() const
 {
     std::vector<const FileAsset*> assets;
@@ -0,0 +1,263 @@
+#include "rive/file_metadata.hpp"
+#include "rive/runtime_header.hpp"
+#include "rive/assets/unique_asset_ids.hpp"
+#include "rive/core/binary_reader.hpp"
+#include "rive/core/field_types/core_color_type.hpp"
+#include "rive/core/field_types/core_double_type.hpp"
+#include "rive/core/field_types/core_string_type.hpp"
+#include "rive/core/field_types/core_uint_type.hpp"
+#include "rive/generated/core_registry.hpp"
+#include <cmath>
+#include <cstdio>
+
+using namespace rive;
+
+float LinearAnimationMetadata::durationSeconds() const
+{
+    float start = (enableWorkArea ? workStart : 0) / (float)fps;
+    float end = (enableWorkArea ? workEnd : duration) / (float)fps;
+    return std::abs(end - start);
+}
+
+namespace
+{
+/// A property's value, as much of it as the scan needs.
+struct PropertyValue
+{
+    uint64_t uintValue = 0;
+    float doubleValue = 0.0f;
+    Span<const uint8_t> bytesValue;
+
+    std::string string() const
+    {
+        return std::string((const char*)bytesValue.data(), bytesValue.size());
+    }
+};
+} // namespace
+
+ImportResult FileMetadata::scan(Span<const uint8_t> data, FileMetadata* metadata)
+{
+    BinaryReader reader(data);
+    RuntimeHeader header;
+    if (!RuntimeHeader::read(reader, header))
+    {
+        return ImportResult::malformed;
+    }
+    if (header.majorVersion() != File::majorVersion)
+    {
+        return ImportResult::unsupportedVersion;
+    }
+    metadata->artboards.clear();
+    metadata->assets.clear();
+
+    // Objects are added to the latest of their parents in the file, as when
+    // they're imported.
+    bool hasBackboard = false;
+    bool hasArtboard = false;
+    bool hasStateMachine = false;
+    bool hasAsset = false;
+    while (!reader.reachedEnd())
+    {
+        auto coreType = reader.readVarUintAs<uint16_t>();
+        switch (coreType)
+        {
+            case BackboardBase::typeKey:
+                hasBackboard = true;
+                break;
+            case ArtboardBase::typeKey:
+                if (hasBackboard)
+                {
+                    metadata->artboards.emplace_back();
+                    hasArtboard = true;
+                    hasStateMachine = false;
+                }
+                break;
+            case LinearAnimationBase::typeKey:
+                if (hasArtboard)
+                {
+                    metadata->artboards.back().animations.emplace_back();
+                }
+                break;
+            case StateMachineBase::typeKey:
+                if (hasArtboard)
+                {
+                    metadata->artboards.back().stateMachines.emplace_back();
+                    hasStateMachine = true;
+                }
+                break;
+            case StateMachineBoolBase::typeKey:
+            case StateMachineNumberBase::typeKey:
+            case StateMachineTriggerBase::typeKey:
+                if (hasStateMachine)
+                {
+                    StateMachineInputMetadata input;
+                    input.coreType = coreType;
+                    metadata->artboards.back().stateMachines.back().inputs.push_back(input);
+                }
+                break;
+            case ImageAssetBase::typeKey:
+            case FontAssetBase::typeKey:
+                if (hasBackboard)
+                {
+                    FileAssetMetadata asset;
+                    asset.coreType = coreType;
+                    metadata->assets.push_back(asset);
+                    hasAsset = true;
+                }
+                break;
+            case FileAssetContentsBase::typeKey:
+                if (hasAsset)
+                {
+                    metadata->assets.back().inBand = true;
+                }
+                break;
+        }
+
+        while (true)
+        {
+            auto propertyKey = reader.readVarUintAs<uint16_t>();
+            if (propertyKey == 0)
+            {
+                break;
+            }
+            if (reader.hasError())
+            {
+                return ImportResult::malformed;
+            }
+            int id = CoreRegistry::propertyFieldId(propertyKey);
+            if (id == -1)
+            {
+                id = header.propertyFieldId(propertyKey);
+            }
+            PropertyValue value;
+            switch (id)
+            {
+                case CoreUintType::id:
+                    value.uintValue = reader.readVarUint64();
+                    break;
+                case CoreStringType::id:
+                    value.bytesValue = reader.readBytes();
+                    break;
+                case CoreDoubleType::id:
+                    value.doubleValue = reader.readFloat32();
+                    break;
+                case CoreColorType::id:
+                    reader.readUint32();
+                    break;
+                default:
+                    fprintf(stderr,
+                            "Unknown property key %d, missing from property ToC.\n",
+                            propertyKey);
+                    return ImportResult::malformed;
+            }
+
+            switch (coreType)
+            {
+                case ArtboardBase::typeKey:
+                    if (!hasArtboard)
+                    {
+                        break;
+                    }
+                    switch (propertyKey)
+                    {
+                        case ComponentBase::namePropertyKey:
+                            metadata->artboards.back().name = value.string();
+                            break;
+                        case ArtboardBase::widthPropertyKey:
+                            metadata->artboards.back().width = value.doubleValue;
+                            break;
+                        case ArtboardBase::heightPropertyKey:
+                            metadata->artboards.back().height = value.doubleValue;
+                            break;
+                    }
+                    break;
+                case LinearAnimationBase::typeKey:
+                {
+                    if (!hasArtboard)
+                    {
+                        break;
+                    }
+                    auto& animation = metadata->artboards.back().animations.back();
+                    switch (propertyKey)
+                    {
+                        case AnimationBase::namePropertyKey:
+                            animation.name = value.string();
+                            break;
+                        case LinearAnimationBase::fpsPropertyKey:
+                            animation.fps = (uint32_t)value.uintValue;
+                            break;
+                        case LinearAnimationBase::durationPropertyKey:
+                            animation.duration = (uint32_t)value.uintValue;
+                            break;
+                        case LinearAnimationBase::speedPropertyKey:
+                            animation.speed = value.doubleValue;
+                            break;
+                        case LinearAnimationBase::loopValuePropertyKey:
+                            animation.loopValue = (uint32_t)value.uintValue;
+                            break;
+                        case LinearAnimationBase::workStartPropertyKey:
+                            animation.workStart = (uint32_t)value.uintValue;
+                            break;
+                        case LinearAnimationBase::workEndPropertyKey:
+                            animation.workEnd = (uint32_t)value.uintValue;
+                            break;
+                        case LinearAnimationBase::enableWorkAreaPropertyKey:
+                            animation.enableWorkArea = value.uintValue != 0;
+                            break;
+                    }
+                    break;
+                }
+                case StateMachineBase::typeKey:
+                    if (hasArtboard && propertyKey == AnimationBase::namePropertyKey)
+                    {
+                        metadata->artboards.back().stateMachines.back().name = value.string();
+                    }
+                    break;
+                case StateMachineBoolBase::typeKey:
+                case StateMachineNumberBase::typeKey:
+                case StateMachineTriggerBase::typeKey:
+                    if (hasStateMachine &&
+                        propertyKey == StateMachineComponentBase::namePropertyKey)
+                    {
+                        metadata->artboards.back().stateMachines.back().inputs.back().name =
+                            value.string();
+                    }
+                    break;
+                case ImageAssetBase::typeKey:
+                case FontAssetBase::typeKey:
+                    if (!hasBackboard)
+                    {
+                        break;
+                    }
+                    switch (propertyKey)
+                    {
+                        case AssetBase::namePropertyKey:
+                            metadata->assets.back().name = value.string();
+                            break;
+                        case FileAssetBase::assetIdPropertyKey:
+                            metadata->assets.back().assetId = (uint32_t)value.uintValue;
+                            break;
+                    }
+                    break;
+                case FileAssetContentsBase::typeKey:
+                    if (hasAsset && propertyKey == FileAssetContentsBase::bytesPropertyKey)
+                    {
+                        metadata->assets.back().contentsSize = value.bytesValue.size();
+                    }
+                    break;
+            }
+        }
+    }
+    if (reader.hasError())
+    {
+        return ImportResult::malformed;
+    }
+
+    // Make asset ids unique, as BackboardImporter does while importing.
+    UniqueAssetIds assetIds;
+    for (auto& asset : metadata->assets)
+    {
+        asset.assetId = assetIds.add(asset.assetId);
+    }
+    return ImportResult::success;
+}
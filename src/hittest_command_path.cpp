@@ -8,6 +8,13 @@ using namespace rive;
 
 HitTestCommandPath::HitTestCommandPath(const IAABB& area) : m_Area(area) { m_Tester.reset(m_Area); }
 
+void HitTestCommandPath::reset(const IAABB& area)
+{
+    m_Area = area;
+    m_FillRule = FillRule::nonZero;
+    m_Tester.reset(m_Area);
+}
+
 bool HitTestCommandPath::wasHit() { return m_Tester.test(m_FillRule); }
 
 void HitTestCommandPath::rewind() { m_Tester.reset(m_Area); }
@@ -3,7 +3,6 @@
 #include "rive/nested_artboard.hpp"
 #include "rive/assets/file_asset_referencer.hpp"
 #include "rive/assets/file_asset.hpp"
-#include <unordered_set>
 
 using namespace rive;
 
@@ -23,22 +22,13 @@ void BackboardImporter::addFileAsset(FileAsset* asset)
         // --------------
         // Ensure assetIds are unique. Due to an editor bug:
         // https://github.com/rive-app/rive/issues/4204
-        std::unordered_set<uint32_t> ids;
-        uint32_t nextId = 1;
-        for (auto fileAsset : m_FileAssets)
+        //
+        // Only the new asset is renamed: the ones added before it are already
+        // unique, and their contents may be decoding on another thread.
+        uint32_t assetId = m_FileAssetIds.add(asset->assetId());
+        if (assetId != asset->assetId())
         {
-            if (ids.count(fileAsset->assetId()))
-            {
-                fileAsset->assetId(nextId);
-            }
-            else
-            {
-                ids.insert(fileAsset->assetId());
-                if (fileAsset->assetId() >= nextId)
-                {
-                    nextId = fileAsset->assetId() + 1;
-                }
-            }
+            asset->assetId(assetId);
         }
 
         // --------------
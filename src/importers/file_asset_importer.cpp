@@ -3,14 +3,54 @@
 #include "rive/assets/file_asset.hpp"
 #include "rive/file_asset_resolver.hpp"
 #include "rive/span.hpp"
+#include "rive/worker_pool.hpp"
 #include <cstdint>
 
 using namespace rive;
 
+AssetDecodeJobs::AssetDecodeJobs(Executor* executor, Factory* factory) :
+    m_Executor(executor), m_Factory(factory)
+{}
+
+AssetDecodeJobs::~AssetDecodeJobs() { wait(); }
+
+void AssetDecodeJobs::decode(FileAsset* asset, Span<const uint8_t> bytes)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Pending++;
+    }
+    m_Executor->execute([this, asset, bytes]() {
+        bool decoded = asset->decode(bytes, m_Factory);
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (!decoded)
+        {
+            m_Failed.push_back(asset);
+        }
+        if (--m_Pending == 0)
+        {
+            m_JobDone.notify_all();
+        }
+    });
+}
+
+std::vector<FileAsset*> AssetDecodeJobs::wait()
+{
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_JobDone.wait(lock, [this] { return m_Pending == 0; });
+    std::vector<FileAsset*> failed;
+    failed.swap(m_Failed);
+    return failed;
+}
+
 FileAssetImporter::FileAssetImporter(FileAsset* fileAsset,
                                      FileAssetResolver* assetResolver,
-                                     Factory* factory) :
-    m_FileAsset(fileAsset), m_FileAssetResolver(assetResolver), m_Factory(factory)
+                                     Factory* factory,
+                                     AssetDecodeJobs* decodeJobs) :
+    m_FileAsset(fileAsset),
+    m_FileAssetResolver(assetResolver),
+    m_Factory(factory),
+    m_DecodeJobs(decodeJobs)
 {}
 
 void FileAssetImporter::loadContents(std::unique_ptr<FileAssetContents> contents)
@@ -20,7 +60,14 @@ void FileAssetImporter::loadContents(std::unique_ptr<FileAssetContents> contents
     m_Content = std::move(contents);
 
     auto data = m_Content->bytes();
-    if (m_FileAsset->decode(data, m_Factory))
+    if (m_DecodeJobs != nullptr)
+    {
+        // Whoever made the jobs falls back to the resolver for assets that
+        // fail to decode.
+        m_DecodeJobs->decode(m_FileAsset, data);
+        m_LoadedContents = true;
+    }
+    else if (m_FileAsset->decode(data, m_Factory))
     {
         m_LoadedContents = true;
     }
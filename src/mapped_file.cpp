@@ -0,0 +1,71 @@
+#include "rive/mapped_file.hpp"
+#include <cstdio>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define RIVE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace rive;
+
+MappedFile::~MappedFile()
+{
+#ifdef RIVE_MMAP
+    if (m_Mapped)
+    {
+        munmap((void*)m_Bytes.data(), m_Bytes.size());
+    }
+#endif
+}
+
+std::unique_ptr<MappedFile> MappedFile::open(const char* path)
+{
+    std::unique_ptr<MappedFile> file(new MappedFile());
+#ifdef RIVE_MMAP
+    int fd = ::open(path, O_RDONLY);
+    if (fd == -1)
+    {
+        return nullptr;
+    }
+    struct stat info;
+    if (fstat(fd, &info) == 0 && info.st_size > 0)
+    {
+        void* bytes = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (bytes != MAP_FAILED)
+        {
+            file->m_Bytes = Span<const uint8_t>((const uint8_t*)bytes, (size_t)info.st_size);
+            file->m_Mapped = true;
+            close(fd);
+            return file;
+        }
+    }
+    close(fd);
+#endif
+
+    // Fall back to reading the whole file.
+    FILE* fp = fopen(path, "rb");
+    if (fp == nullptr)
+    {
+        return nullptr;
+    }
+    fseek(fp, 0, SEEK_END);
+    const long length = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    if (length < 0)
+    {
+        fclose(fp);
+        return nullptr;
+    }
+    file->m_Copy.resize((size_t)length);
+    bool read = fread(file->m_Copy.data(), 1, (size_t)length, fp) == (size_t)length;
+    fclose(fp);
+    if (!read)
+    {
+        return nullptr;
+    }
+    file->m_Bytes = file->m_Copy;
+    return file;
+}
@@ -3,6 +3,7 @@
  */
 
 #include "rive/math/hit_test.hpp"
+#include "rive/math/simd.hpp"
 
 #include <algorithm>
 #include <assert.h>
@@ -24,6 +25,7 @@ struct Point
     Point() {}
     Point(float xx, float yy) : x(xx), y(yy) {}
     Point(const Vec2D& src) : x(src.x), y(src.y) {}
+    operator Vec2D() const { return {x, y}; }
 
     Point operator+(Point v) const { return {x + v.x, y + v.y}; }
     Point operator-(Point v) const { return {x - v.x, y - v.y}; }
@@ -71,15 +73,34 @@ static void append_line(const float height,
     // we add 0.5 at the end to pre-round the values
     float x = p0.x + m * (top - p0.y + 0.5f) + 0.5f;
 
+    // Columns are clamped to [0, iwidth], iwidth meaning past the right
+    // edge (which doesn't contribute).
+    const float maxColumn = (float)iwidth;
     int* row = delta + top * iwidth;
-    for (int y = top; y < bottom; ++y)
+    int rows = bottom - top;
+    int y = 0;
+    // Compute the column of 4 rows at a time.
+    const float4 firstX = x + m * float4{0.0f, 1.0f, 2.0f, 3.0f};
+    for (; y + 4 <= rows; y += 4)
     {
-        int ix = (int)std::max(x, 0.0f);
+        float4 rowX = firstX + m * (float)y;
+        int4 ix = simd::cast<int32_t>(simd::clamp(rowX, float4(0.0f), float4(maxColumn)));
+        for (int i = 0; i < 4; i++)
+        {
+            if (ix[i] < iwidth)
+            {
+                row[ix[i]] += winding;
+            }
+            row += iwidth;
+        }
+    }
+    for (; y < rows; y++)
+    {
+        int ix = (int)std::min(std::max(x + m * y, 0.0f), maxColumn);
         if (ix < iwidth)
         {
             row[ix] += winding;
         }
-        x += m;
         row += iwidth;
     }
 }
@@ -122,6 +143,52 @@ static void clip_line(const float height, Point p0, Point p1, int delta[], const
     append_line(height, p0, p1, m, winding, delta, iwidth);
 }
 
+// Same result as clip_line for areas of at most HitTester::kAnalyticArea
+// pixels (so at most 4 rows), without the row stride: each pixel sums the
+// signed crossings of its row's center left of it.
+static void sum_crossings(const float height, Point p0, Point p1, int sums[], const int iwidth)
+{
+    if (p0.y == p1.y)
+    {
+        return;
+    }
+
+    int winding = 1;
+    if (p0.y > p1.y)
+    {
+        winding = -1;
+        std::swap(p0, p1);
+    }
+    if (p1.y <= 0 || p0.y >= height)
+    {
+        return;
+    }
+
+    const float m = (float)(p1.x - p0.x) / (p1.y - p0.y);
+    if (p0.y < 0)
+    {
+        p0.x += m * (0 - p0.y);
+        p0.y = 0;
+    }
+    if (p1.y > height)
+    {
+        p1.x += m * (height - p1.y);
+        p1.y = height;
+    }
+
+    int top = graphics_round(p0.y);
+    int bottom = graphics_round(p1.y);
+    float x = p0.x + m * (top - p0.y + 0.5f) + 0.5f;
+    for (int y = top; y < bottom; y++)
+    {
+        int ix = (int)std::min(std::max(x + m * (float)(y - top), 0.0f), (float)iwidth);
+        if (ix < iwidth)
+        {
+            sums[y * iwidth + ix] += winding;
+        }
+    }
+}
+
 #define MAX_CURVE_SEGMENTS (1 << 8)
 
 static int compute_cubic_segments(Point a, Point b, Point c, Point d)
@@ -167,7 +234,12 @@ struct CubicCoeff
 
 ////////////////////////////////////////////
 
-void HitTester::reset() { m_DW.clear(); }
+void HitTester::reset()
+{
+    m_DW.clear();
+    m_UsesInlineDW = false;
+    m_IWidth = m_IHeight = 0;
+}
 
 void HitTester::reset(const IAABB& clip)
 {
@@ -176,15 +248,37 @@ void HitTester::reset(const IAABB& clip)
 
     m_IWidth = clip.width();
     m_IHeight = clip.height();
-    m_DW.resize(m_IWidth * m_IHeight);
-    for (size_t i = 0; i < m_DW.size(); ++i)
+    int area = m_IWidth * m_IHeight;
+    m_Analytic = area <= kAnalyticArea;
+#ifdef TESTING
+    m_Analytic = m_Analytic && m_AnalyticAreas;
+#endif
+    m_UsesInlineDW = area <= kInlineArea;
+    if (m_UsesInlineDW)
+    {
+        std::fill(m_InlineDW, m_InlineDW + area, 0);
+    }
+    else
     {
-        m_DW[i] = 0;
+        // Keeps the capacity from previous tests.
+        m_DW.assign(area, 0);
     }
 
     m_ExpectsMove = true;
 }
 
+void HitTester::addSegment(Vec2D p0, Vec2D p1)
+{
+    if (m_Analytic)
+    {
+        sum_crossings(m_height, p0, p1, m_InlineDW, m_IWidth);
+    }
+    else
+    {
+        clip_line(m_height, p0, p1, deltas(), m_IWidth);
+    }
+}
+
 void HitTester::move(Vec2D v)
 {
     if (!m_ExpectsMove)
@@ -200,7 +294,7 @@ void HitTester::line(Vec2D v)
     assert(!m_ExpectsMove);
 
     v = v - m_offset;
-    clip_line(m_height, m_Prev, v, m_DW.data(), m_IWidth);
+    addSegment(m_Prev, v);
     m_Prev = v;
 }
 
@@ -257,6 +351,32 @@ struct CubicChop
 //
 #define MAX_LOCAL_SEGMENTS 16
 
+// Only for analytic areas, where it's cheap compared to flattening. A curve
+// right of the area crosses no pixel's row center left of the pixel, and one
+// left of it crosses each row as many times (and ways) as the line between
+// its ends. The half pixel margins keep flattened points, which can stray
+// from the control points' hull by rounding, on the same side.
+bool HitTester::cullCubic(Vec2D b, Vec2D c, Vec2D d)
+{
+    if (!m_Analytic)
+    {
+        return false;
+    }
+    const float right = (float)m_IWidth;
+    if (m_Prev.x >= right && b.x >= right && c.x >= right && d.x >= right)
+    {
+        m_Prev = d;
+        return true;
+    }
+    if (m_Prev.x <= 0 && b.x <= 0 && c.x <= 0 && d.x <= 0)
+    {
+        addSegment(m_Prev, d);
+        m_Prev = d;
+        return true;
+    }
+    return false;
+}
+
 void HitTester::recurse_cubic(Vec2D b, Vec2D c, Vec2D d, int count)
 {
     if (quickRejectCubic(m_height, m_Prev, b, c, d))
@@ -264,6 +384,10 @@ void HitTester::recurse_cubic(Vec2D b, Vec2D c, Vec2D d, int count)
         m_Prev = d;
         return;
     }
+    if (cullCubic(b, c, d))
+    {
+        return;
+    }
 
     if (count > MAX_LOCAL_SEGMENTS)
     {
@@ -284,11 +408,11 @@ void HitTester::recurse_cubic(Vec2D b, Vec2D c, Vec2D d, int count)
         for (int i = 1; i < count - 1; ++i)
         {
             auto next = cube.eval(t);
-            clip_line(m_height, prev, next, m_DW.data(), m_IWidth);
+            addSegment(prev, next);
             prev = next;
             t += dt;
         }
-        clip_line(m_height, prev, d, m_DW.data(), m_IWidth);
+        addSegment(prev, d);
         m_Prev = d;
     }
 }
@@ -305,6 +429,10 @@ void HitTester::cubic(Vec2D b, Vec2D c, Vec2D d)
         m_Prev = d;
         return;
     }
+    if (cullCubic(b, c, d))
+    {
+        return;
+    }
 
     const int count = compute_cubic_segments(m_Prev, b, c, d);
 
@@ -315,7 +443,7 @@ void HitTester::close()
 {
     assert(!m_ExpectsMove);
 
-    clip_line(m_height, m_Prev, m_First, m_DW.data(), m_IWidth);
+    addSegment(m_Prev, m_First);
     m_ExpectsMove = true;
 }
 
@@ -353,10 +481,11 @@ bool HitTester::test(FillRule rule)
 
     const int mask = (rule == rive::FillRule::nonZero) ? -1 : 1;
 
+    const int* dw = deltas();
     int nonzero = 0;
-    for (auto m : m_DW)
+    for (int i = 0, count = m_IWidth * m_IHeight; i < count; i++)
     {
-        nonzero |= (m & mask);
+        nonzero |= (dw[i] & mask);
     }
     return nonzero != 0;
 }
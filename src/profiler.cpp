@@ -0,0 +1,217 @@
+#include "rive/profiler.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <mutex>
+
+using namespace rive;
+
+namespace
+{
+std::atomic<bool> gEnabled(false);
+std::atomic<uint32_t> gThreadCount(0);
+std::atomic<uint32_t> gComponentUpdates[ProfileFrame::kDirtCount];
+
+std::mutex gMutex;
+std::vector<ProfileEvent> gEvents;
+uint64_t gFrameStart = 0;
+
+uint32_t threadIndex()
+{
+    static thread_local uint32_t index = gThreadCount.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+const char* const kPhaseNames[] = {
+    "import",
+    "instance",
+    "advance",
+    "keyFrameApply",
+    "updateComponents",
+    "pathRebuild",
+    "hitTest",
+    "textShaping",
+    "draw",
+};
+
+const char* const kDirtNames[ProfileFrame::kDirtCount] = {
+    "Collapsed",
+    "Dependents",
+    "Components",
+    "DrawOrder",
+    "Path",
+    "Vertices",
+    "Transform",
+    "WorldTransform",
+    "RenderOpacity",
+    "Paint",
+    "Stops",
+};
+
+// Trace event timestamps are in microseconds.
+void appendMicroseconds(std::string& out, uint64_t nanoseconds)
+{
+    char buffer[32];
+    snprintf(buffer,
+             sizeof(buffer),
+             "%" PRIu64 ".%03" PRIu64,
+             nanoseconds / 1000,
+             nanoseconds % 1000);
+    out += buffer;
+}
+} // namespace
+
+uint64_t ProfileFrame::duration(ProfilePhase phase) const
+{
+    // Sorted by thread and start, a nested scope starts before the end of
+    // the one holding it.
+    std::vector<const ProfileEvent*> scopes;
+    for (const auto& event : events)
+    {
+        if (event.phase == phase)
+        {
+            scopes.push_back(&event);
+        }
+    }
+    std::sort(scopes.begin(), scopes.end(), [](const ProfileEvent* a, const ProfileEvent* b) {
+        return a->thread != b->thread ? a->thread < b->thread : a->start < b->start;
+    });
+    uint64_t total = 0;
+    uint32_t thread = 0;
+    uint64_t end = 0;
+    for (auto scope : scopes)
+    {
+        if (scope->thread == thread && scope->start < end)
+        {
+            continue;
+        }
+        total += scope->duration;
+        thread = scope->thread;
+        end = scope->start + scope->duration;
+    }
+    return total;
+}
+
+size_t ProfileFrame::count(ProfilePhase phase) const
+{
+    return (size_t)std::count_if(events.begin(),
+                                 events.end(),
+                                 [phase](const ProfileEvent& event) { return event.phase == phase; });
+}
+
+void Profiler::enable(bool value)
+{
+    if (value && !gEnabled)
+    {
+        std::lock_guard<std::mutex> lock(gMutex);
+        gFrameStart = now();
+    }
+    gEnabled = value;
+}
+
+bool Profiler::enabled() { return gEnabled.load(std::memory_order_relaxed); }
+
+uint64_t Profiler::now()
+{
+    static const auto epoch = std::chrono::steady_clock::now();
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now() - epoch)
+        .count();
+}
+
+void Profiler::record(ProfilePhase phase, uint64_t start, uint64_t end)
+{
+    ProfileEvent event = {phase, threadIndex(), start, end - start};
+    std::lock_guard<std::mutex> lock(gMutex);
+    gEvents.push_back(event);
+}
+
+void Profiler::countUpdate(ComponentDirt dirt)
+{
+    auto bits = static_cast<std::underlying_type<ComponentDirt>::type>(dirt);
+    for (int i = 0; i < ProfileFrame::kDirtCount; i++)
+    {
+        if ((bits & (1 << i)) != 0)
+        {
+            gComponentUpdates[i].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+ProfileFrame Profiler::endFrame()
+{
+    ProfileFrame frame;
+    std::lock_guard<std::mutex> lock(gMutex);
+    frame.start = gFrameStart;
+    frame.end = gFrameStart = now();
+    frame.events.swap(gEvents);
+    for (int i = 0; i < ProfileFrame::kDirtCount; i++)
+    {
+        frame.componentUpdates[i] = gComponentUpdates[i].exchange(0, std::memory_order_relaxed);
+    }
+    return frame;
+}
+
+const char* Profiler::name(ProfilePhase phase) { return kPhaseNames[(int)phase]; }
+
+const char* Profiler::dirtName(int dirtBit)
+{
+    return dirtBit >= 0 && dirtBit < ProfileFrame::kDirtCount ? kDirtNames[dirtBit] : "";
+}
+
+std::string Profiler::chromeTrace(const std::vector<ProfileFrame>& frames)
+{
+    std::string out = "{\"traceEvents\":[";
+    bool first = true;
+    auto beginEvent = [&out, &first]() {
+        if (!first)
+        {
+            out += ",";
+        }
+        first = false;
+        out += "\n{";
+    };
+    for (const auto& frame : frames)
+    {
+        for (const auto& event : frame.events)
+        {
+            beginEvent();
+            out += "\"name\":\"";
+            out += name(event.phase);
+            out += "\",\"cat\":\"rive\",\"ph\":\"X\",\"pid\":0,\"tid\":";
+            out += std::to_string(event.thread);
+            out += ",\"ts\":";
+            appendMicroseconds(out, event.start);
+            out += ",\"dur\":";
+            appendMicroseconds(out, event.duration);
+            out += "}";
+        }
+
+        beginEvent();
+        out += "\"name\":\"componentUpdates\",\"cat\":\"rive\",\"ph\":\"C\",\"pid\":0,\"ts\":";
+        appendMicroseconds(out, frame.end);
+        out += ",\"args\":{";
+        for (int i = 0; i < ProfileFrame::kDirtCount; i++)
+        {
+            if (i != 0)
+            {
+                out += ",";
+            }
+            out += "\"";
+            out += kDirtNames[i];
+            out += "\":";
+            out += std::to_string(frame.componentUpdates[i]);
+        }
+        out += "}}";
+
+        beginEvent();
+        out += "\"name\":\"frame\",\"cat\":\"rive\",\"ph\":\"i\",\"s\":\"g\",\"pid\":0,\"tid\":0,"
+               "\"ts\":";
+        appendMicroseconds(out, frame.end);
+        out += "}";
+    }
+    out += "\n]}\n";
+    return out;
+}
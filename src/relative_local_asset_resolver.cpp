@@ -0,0 +1,47 @@
+#include "rive/relative_local_asset_resolver.hpp"
+#include "rive/worker_pool.hpp"
+#include <atomic>
+#include <memory>
+
+using namespace rive;
+
+AsyncRelativeLocalAssetResolver::AsyncRelativeLocalAssetResolver(std::string filename,
+                                                                 Factory* factory,
+                                                                 Executor* executor) :
+    m_Factory(factory), m_Executor(executor)
+{
+    std::size_t finalSlash = filename.rfind('/');
+
+    if (finalSlash != std::string::npos)
+    {
+        m_Path = filename.substr(0, finalSlash + 1);
+    }
+}
+
+void AsyncRelativeLocalAssetResolver::loadContents(std::vector<FileAsset*> assets,
+                                                   std::function<void()> done)
+{
+    if (assets.empty())
+    {
+        done();
+        return;
+    }
+    // The last job to finish calls done.
+    auto remaining = std::make_shared<std::atomic<size_t>>(assets.size());
+    for (auto asset : assets)
+    {
+        std::string filename = m_Path + asset->uniqueFilename();
+        Factory* factory = m_Factory;
+        m_Executor->execute([asset, filename, factory, remaining, done]() {
+            auto file = MappedFile::open(filename.c_str());
+            if (file != nullptr)
+            {
+                asset->decode(file->bytes(), factory);
+            }
+            if (--*remaining == 0)
+            {
+                done();
+            }
+        });
+    }
+}
@@ -6,4 +6,4 @@
 
 using namespace rive;
 
-int Counter::counts[Type::kLastType + 1] = {};
+std::atomic<int> Counter::counts[Type::kLastType + 1] = {};
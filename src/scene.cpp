@@ -3,7 +3,8 @@
 
 using namespace rive;
 
-Scene::Scene(ArtboardInstance* abi) : m_ArtboardInstance(abi)
+Scene::Scene(ArtboardInstance* abi) :
+    m_ArtboardInstance(abi), m_Allocator(ref_rcp(abi->allocator()))
 {
     assert(m_ArtboardInstance->isInstance());
 }
@@ -20,6 +21,6 @@ void Scene::pointerUp(Vec2D) {}
 
 size_t Scene::inputCount() const { return 0; }
 SMIInput* Scene::input(size_t index) const { return nullptr; }
-SMIBool* Scene::getBool(const std::string&) const { return nullptr; }
-SMINumber* Scene::getNumber(const std::string&) const { return nullptr; }
-SMITrigger* Scene::getTrigger(const std::string&) const { return nullptr; }
+SMIBool* Scene::getBool(StringView) const { return nullptr; }
+SMINumber* Scene::getNumber(StringView) const { return nullptr; }
+SMITrigger* Scene::getTrigger(StringView) const { return nullptr; }
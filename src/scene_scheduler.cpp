@@ -0,0 +1,148 @@
+#include "rive/scene_scheduler.hpp"
+#include "rive/scene.hpp"
+#include "rive/worker_pool.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+using namespace rive;
+
+namespace
+{
+/// The scenes a thread has left to advance, [begin, end) in the group.
+/// The thread takes them from the front, others steal from the back.
+struct Share
+{
+    std::mutex mutex;
+    size_t begin = 0;
+    size_t end = 0;
+};
+
+/// One call to advance, shared by the threads working on it.
+struct Group
+{
+    Span<Scene* const> scenes;
+    float elapsedSeconds;
+    std::unique_ptr<Share[]> shares;
+    size_t shareCount;
+    /// Whether each scene still needs advancing, written by whichever
+    /// thread advanced it.
+    std::vector<uint8_t> keepGoing;
+
+    std::mutex mutex;
+    std::condition_variable finished;
+    size_t running;
+
+    /// Takes the next scene from share, returns false when it's empty.
+    bool take(Share& share, size_t* index)
+    {
+        std::lock_guard<std::mutex> lock(share.mutex);
+        if (share.begin == share.end)
+        {
+            return false;
+        }
+        *index = share.begin++;
+        return true;
+    }
+
+    /// Moves the back half of another thread's share into share (which is
+    /// empty), returns false when there's nothing left to steal.
+    bool steal(size_t thief)
+    {
+        for (size_t i = 1; i < shareCount; i++)
+        {
+            Share& victim = shares[(thief + i) % shareCount];
+            size_t begin, end;
+            {
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                size_t left = victim.end - victim.begin;
+                if (left == 0)
+                {
+                    continue;
+                }
+                end = victim.end;
+                begin = victim.end - (left + 1) / 2;
+                victim.end = begin;
+            }
+            Share& share = shares[thief];
+            std::lock_guard<std::mutex> lock(share.mutex);
+            share.begin = begin;
+            share.end = end;
+            return true;
+        }
+        return false;
+    }
+
+    void work(size_t thread)
+    {
+        Share& share = shares[thread];
+        size_t index;
+        do
+        {
+            while (take(share, &index))
+            {
+                keepGoing[index] = scenes[index]->advanceAndApply(elapsedSeconds) ? 1 : 0;
+            }
+        } while (steal(thread));
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--running == 0)
+        {
+            finished.notify_one();
+        }
+    }
+};
+} // namespace
+
+SceneScheduler::SceneScheduler(size_t threadCount)
+{
+    if (threadCount == 0)
+    {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    m_ThreadCount = threadCount;
+    if (threadCount > 1)
+    {
+        m_Pool.reset(new WorkerPool(threadCount - 1));
+    }
+}
+
+SceneScheduler::~SceneScheduler() {}
+
+std::vector<Scene*> SceneScheduler::advance(Span<Scene* const> scenes, float elapsedSeconds)
+{
+    Group group;
+    group.scenes = scenes;
+    group.elapsedSeconds = elapsedSeconds;
+    group.shareCount = std::max((size_t)1, std::min(m_ThreadCount, scenes.size()));
+    group.shares.reset(new Share[group.shareCount]);
+    for (size_t i = 0; i < group.shareCount; i++)
+    {
+        group.shares[i].begin = scenes.size() * i / group.shareCount;
+        group.shares[i].end = scenes.size() * (i + 1) / group.shareCount;
+    }
+    group.keepGoing.resize(scenes.size());
+    group.running = group.shareCount;
+
+    Group* shared = &group;
+    for (size_t i = 1; i < group.shareCount; i++)
+    {
+        m_Pool->execute([shared, i]() { shared->work(i); });
+    }
+    group.work(0);
+    {
+        std::unique_lock<std::mutex> lock(group.mutex);
+        group.finished.wait(lock, [&group] { return group.running == 0; });
+    }
+
+    std::vector<Scene*> keepGoing;
+    for (size_t i = 0; i < scenes.size(); i++)
+    {
+        if (group.keepGoing[i])
+        {
+            keepGoing.push_back(scenes[i]);
+        }
+    }
+    return keepGoing;
+}
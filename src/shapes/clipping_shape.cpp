@@ -14,45 +14,35 @@ StatusCode ClippingShape::onAddedClean(CoreContext* context)
     auto clippingHolder = parent();
 
     auto artboard = static_cast<Artboard*>(context);
-    for (auto core : artboard->objects())
+    const auto& objects = artboard->objects();
+    std::vector<uint32_t> ids;
+
+    // Find the drawables parented to this clipping shape, they need to know
+    // they'll be clipped by this shape.
+    if (clippingHolder != nullptr)
+    {
+        artboard->subtreeIds(clippingHolder, ids);
+    }
+    for (auto id : ids)
     {
-        if (core == nullptr)
+        if (objects[id]->is<Drawable>())
         {
-            continue;
-        }
-        // Iterate artboard to find drawables that are parented to this clipping
-        // shape, they need to know they'll be clipped by this shape.
-        if (core->is<Drawable>())
-        {
-            auto drawable = core->as<Drawable>();
-            for (ContainerComponent* component = drawable; component != nullptr;
-                 component = component->parent())
-            {
-                if (component == clippingHolder)
-                {
-                    drawable->addClippingShape(this);
-                    break;
-                }
-            }
+            objects[id]->as<Drawable>()->addClippingShape(this);
         }
+    }
 
-        // Iterate artboard to find shapes that are parented to the source,
-        // their paths will need to be RenderPaths in order to be used for
-        // clipping operations.
+    // Find the shapes parented to the source, their paths will need to be
+    // RenderPaths in order to be used for clipping operations.
+    ids.clear();
+    artboard->subtreeIds(m_Source, ids);
+    for (auto id : ids)
+    {
+        auto core = objects[id];
         if (core->is<Shape>() && core != clippingHolder)
         {
-            auto component = core->as<ContainerComponent>();
-            while (component != nullptr)
-            {
-                if (component == m_Source)
-                {
-                    auto shape = core->as<Shape>();
-                    shape->addDefaultPathSpace(PathSpace::World | PathSpace::Clipping);
-                    m_Shapes.push_back(shape);
-                    break;
-                }
-                component = component->parent();
-            }
+            auto shape = core->as<Shape>();
+            shape->addDefaultPathSpace(PathSpace::World | PathSpace::Clipping);
+            m_Shapes.push_back(shape);
         }
     }
     m_RenderPath = artboard->factory()->makeEmptyRenderPath();
@@ -6,6 +6,7 @@
 #include "rive/shapes/shape.hpp"
 #include "rive/shapes/straight_vertex.hpp"
 #include "rive/math/math_types.hpp"
+#include "rive/profiler.hpp"
 #include <cassert>
 
 using namespace rive;
@@ -254,6 +255,7 @@ void Path::update(ComponentDirt value)
         // Build path doesn't explicitly rewind because we use it to concatenate
         // multiple built paths into a single command path (like the hit
         // tester).
+        RIVE_PROFILE_SCOPE(pathRebuild);
         m_CommandPath->rewind();
         buildPath(*m_CommandPath);
     }
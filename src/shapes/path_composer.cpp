@@ -1,5 +1,6 @@
 #include "rive/shapes/path_composer.hpp"
 #include "rive/artboard.hpp"
+#include "rive/profiler.hpp"
 #include "rive/renderer.hpp"
 #include "rive/shapes/path.hpp"
 #include "rive/shapes/shape.hpp"
@@ -32,12 +33,15 @@ void PathComposer::update(ComponentDirt value)
 {
     if (hasDirt(value, ComponentDirt::Path))
     {
+        // Even when deferred the paths themselves are current.
+        m_Version++;
         if (m_Shape->canDeferPathUpdate())
         {
             m_deferredPathDirt = true;
             return;
         }
         m_deferredPathDirt = false;
+        RIVE_PROFILE_SCOPE(pathRebuild);
 
         auto space = m_Shape->pathSpace();
 
@@ -11,6 +11,8 @@ using namespace rive;
 
 Shape::Shape() : m_PathComposer(this) {}
 
+Shape::~Shape() {}
+
 void Shape::addPath(Path* path)
 {
     // Make sure the path is not already in the shape.
@@ -93,9 +95,63 @@ void Shape::draw(Renderer* renderer)
     }
 }
 
+namespace
+{
+/// Collects the bounds of the points a path is built from.
+class BoundsCommandPath : public CommandPath
+{
+public:
+    AABB bounds = AABB::forExpansion();
+    Mat2D xform;
+
+    void rewind() override { bounds = AABB::forExpansion(); }
+    void fillRule(FillRule value) override {}
+    void addPath(CommandPath* path, const Mat2D& transform) override { assert(false); }
+    RenderPath* renderPath() override
+    {
+        assert(false);
+        return nullptr;
+    }
+    void moveTo(float x, float y) override { AABB::expandTo(bounds, xform * Vec2D(x, y)); }
+    void lineTo(float x, float y) override { AABB::expandTo(bounds, xform * Vec2D(x, y)); }
+    void cubicTo(float ox, float oy, float ix, float iy, float x, float y) override
+    {
+        // Curves are contained in the hull of their control points.
+        AABB::expandTo(bounds, xform * Vec2D(ox, oy));
+        AABB::expandTo(bounds, xform * Vec2D(ix, iy));
+        AABB::expandTo(bounds, xform * Vec2D(x, y));
+    }
+    void close() override {}
+};
+} // namespace
+
+AABB Shape::computeWorldBounds() const
+{
+    BoundsCommandPath boundsPath;
+    for (auto path : m_Paths)
+    {
+        boundsPath.xform = path->pathTransform();
+        path->buildPath(boundsPath);
+    }
+    return boundsPath.bounds;
+}
+
+HitTestCommandPath& Shape::hitTester(const IAABB& area) const
+{
+    if (m_HitTester == nullptr)
+    {
+        m_HitTester.reset(new HitTestCommandPath(area));
+    }
+    else
+    {
+        m_HitTester->reset(area);
+    }
+    return *m_HitTester;
+}
+
 bool Shape::hitTest(const IAABB& area) const
 {
-    HitTestCommandPath tester(area);
+    HitTestCommandPath& tester = hitTester(area);
 
     for (auto path : m_Paths)
     {
@@ -136,7 +192,7 @@ Core* Shape::hitTest(HitInfo* hinfo, const Mat2D& xform)
             mx *= worldTransform();
         }
 
-        HitTestCommandPath tester(hinfo->area);
+        HitTestCommandPath& tester = hitTester(hinfo->area);
 
         for (auto path : m_Paths)
         {
@@ -9,6 +9,7 @@ using namespace rive;
 #include "rive/shapes/paint/shape_paint.hpp"
 #include "rive/artboard.hpp"
 #include "rive/factory.hpp"
+#include "rive/profiler.hpp"
 
 GlyphItr& GlyphItr::operator++()
 {
@@ -492,6 +493,7 @@ void Text::update(ComponentDirt value)
         }
         if (!runs.empty())
         {
+            RIVE_PROFILE_SCOPE(textShaping);
             m_shape = runs[0].font->shapeText(unichars, runs);
             m_lines = breakLines(m_shape,
                                  sizing() == TextSizing::autoWidth ? -1.0f : width(),
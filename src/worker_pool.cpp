@@ -0,0 +1,59 @@
+#include "rive/worker_pool.hpp"
+#include <algorithm>
+
+using namespace rive;
+
+WorkerPool::WorkerPool(size_t threadCount)
+{
+    if (threadCount == 0)
+    {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    m_Threads.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; i++)
+    {
+        m_Threads.emplace_back(&WorkerPool::work, this);
+    }
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stopping = true;
+    }
+    m_JobAdded.notify_all();
+    for (auto& thread : m_Threads)
+    {
+        thread.join();
+    }
+}
+
+void WorkerPool::execute(std::function<void()> job)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Jobs.push_back(std::move(job));
+    }
+    m_JobAdded.notify_one();
+}
+
+void WorkerPool::work()
+{
+    while (true)
+    {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_JobAdded.wait(lock, [this] { return m_Stopping || !m_Jobs.empty(); });
+            if (m_Jobs.empty())
+            {
+                // Stopping, with nothing left to run.
+                return;
+            }
+            job = std::move(m_Jobs.front());
+            m_Jobs.pop_front();
+        }
+        job();
+    }
+}
@@ -0,0 +1,247 @@
+#include "rive/world_transform_pass.hpp"
+#include "rive/bones/bone.hpp"
+#include "rive/math/simd.hpp"
+#include "rive/profiler.hpp"
+#include "rive/transform_component.hpp"
+#include "rive/world_transform_component.hpp"
+#include <algorithm>
+
+using namespace rive;
+
+namespace
+{
+// Rows of WorldTransformPass::m_Lanes.
+enum Lane
+{
+    kRotation0 = 0, // 4 rows
+    kScaleX = 4,
+    kScaleY = 5,
+    kX = 6,
+    kY = 7,
+    kParent = 8, // 6 rows
+    kLocal = 14, // 6 rows
+    kWorld = 20, // 6 rows
+    kLaneCount = 26
+};
+} // namespace
+
+void WorldTransformPass::build(const std::vector<Component*>& dependencyOrder)
+{
+    m_Components.clear();
+    m_GraphOrders.clear();
+    m_Parents.clear();
+    m_LevelEnds.clear();
+    m_Levels.clear();
+    m_Indices.assign(dependencyOrder.size(), -1);
+    m_Pending.clear();
+
+    // Parents come before their children in dependency order, so one walk
+    // finds each component's depth (or that it can't be batched).
+    // candidateIndices maps a graph order to its entry in candidates.
+    std::vector<TransformComponent*> candidates;
+    std::vector<uint32_t> depths;
+    std::vector<int32_t> candidateIndices(dependencyOrder.size(), -1);
+    uint32_t levelCount = 0;
+    for (auto component : dependencyOrder)
+    {
+        if (!component->is<TransformComponent>())
+        {
+            continue;
+        }
+        auto transformComponent = component->as<TransformComponent>();
+        if (!transformComponent->m_Constraints.empty() ||
+            (component->is<Bone>() && !component->as<Bone>()->peerConstraints().empty()))
+        {
+            continue;
+        }
+        auto parent = component->parent();
+        uint32_t depth = 0;
+        if (parent != nullptr && parent->is<TransformComponent>())
+        {
+            auto parentOrder = parent->graphOrder();
+            if (parentOrder >= candidateIndices.size() || candidateIndices[parentOrder] == -1)
+            {
+                continue;
+            }
+            depth = depths[candidateIndices[parentOrder]] + 1;
+        }
+        candidateIndices[component->graphOrder()] = (int32_t)candidates.size();
+        candidates.push_back(transformComponent);
+        depths.push_back(depth);
+        levelCount = std::max(levelCount, depth + 1);
+    }
+
+    for (uint32_t depth = 0; depth < levelCount; depth++)
+    {
+        for (size_t i = 0; i < candidates.size(); i++)
+        {
+            if (depths[i] != depth)
+            {
+                continue;
+            }
+            auto component = candidates[i];
+            auto parent = component->parent();
+            m_Indices[component->graphOrder()] = (int32_t)m_Components.size();
+            m_Levels.push_back(depth);
+            m_Components.push_back(component);
+            m_GraphOrders.push_back(component->graphOrder());
+            m_Parents.push_back(parent != nullptr && parent->is<WorldTransformComponent>()
+                                    ? parent->as<WorldTransformComponent>()
+                                    : nullptr);
+        }
+        m_LevelEnds.push_back((uint32_t)m_Components.size());
+    }
+
+    // Components start out filthy, so everything is queued for the first
+    // update.
+    m_Pending.resize(levelCount);
+    for (uint32_t level = 0, i = 0; level < levelCount; level++)
+    {
+        for (; i < m_LevelEnds[level]; i++)
+        {
+            m_Pending[level].push_back(i);
+        }
+    }
+    m_Queued.assign(m_Components.size(), true);
+    m_PendingCount = m_Components.size();
+}
+
+bool WorldTransformPass::update(std::vector<uint64_t>& dirtyComponents)
+{
+    const ComponentDirt transformDirt = ComponentDirt::Transform | ComponentDirt::WorldTransform;
+    if (m_PendingCount == 0)
+    {
+        return false;
+    }
+    m_PendingCount = 0;
+
+    bool didUpdate = false;
+    for (auto& pending : m_Pending)
+    {
+        m_Dirty.clear();
+        // A queued component may have been updated (or collapsed) since it
+        // was queued, if it's dirtied again it's queued again.
+        for (auto i : pending)
+        {
+            m_Queued[i] = false;
+            auto dirt = m_Components[i]->m_Dirt;
+            if ((dirt & transformDirt) != ComponentDirt::None &&
+                (dirt & ComponentDirt::Collapsed) != ComponentDirt::Collapsed)
+            {
+                m_Dirty.push_back(i);
+            }
+        }
+        pending.clear();
+        if (m_Dirty.empty())
+        {
+            continue;
+        }
+        didUpdate = true;
+
+        size_t count = m_Dirty.size();
+        size_t stride = (count + 3) & ~3;
+        if (m_Lanes.size() < stride * kLaneCount)
+        {
+            m_Lanes.resize(stride * kLaneCount);
+        }
+        float* lanes[kLaneCount];
+        for (int row = 0; row < kLaneCount; row++)
+        {
+            lanes[row] = m_Lanes.data() + row * stride;
+        }
+
+        // Gather. Components that only need their world transform keep their
+        // current local transform (scaled by 1).
+        for (size_t j = 0; j < stride; j++)
+        {
+            Mat2D local, parent;
+            float scaleX = 1.0f, scaleY = 1.0f;
+            if (j < count)
+            {
+                auto component = m_Components[m_Dirty[j]];
+                if (component->hasDirt(ComponentDirt::Transform))
+                {
+                    local = Mat2D::fromRotation(component->rotation());
+                    local[4] = component->x();
+                    local[5] = component->y();
+                    scaleX = component->scaleX();
+                    scaleY = component->scaleY();
+                }
+                else
+                {
+                    local = component->transform();
+                }
+                if (auto parentComponent = m_Parents[m_Dirty[j]])
+                {
+                    parent = parentComponent->worldTransform();
+                }
+            }
+            for (int k = 0; k < 4; k++)
+            {
+                lanes[kRotation0 + k][j] = local[k];
+            }
+            lanes[kScaleX][j] = scaleX;
+            lanes[kScaleY][j] = scaleY;
+            lanes[kX][j] = local[4];
+            lanes[kY][j] = local[5];
+            for (int k = 0; k < 6; k++)
+            {
+                lanes[kParent + k][j] = parent[k];
+            }
+        }
+
+        // Same operations, in the same order, as
+        // TransformComponent::updateTransform and updateWorldTransform.
+        for (size_t j = 0; j < stride; j += 4)
+        {
+            float4 scaleX = simd::load4f(lanes[kScaleX] + j);
+            float4 scaleY = simd::load4f(lanes[kScaleY] + j);
+            float4 l0 = simd::load4f(lanes[kRotation0] + j) * scaleX;
+            float4 l1 = simd::load4f(lanes[kRotation0 + 1] + j) * scaleX;
+            float4 l2 = simd::load4f(lanes[kRotation0 + 2] + j) * scaleY;
+            float4 l3 = simd::load4f(lanes[kRotation0 + 3] + j) * scaleY;
+            float4 l4 = simd::load4f(lanes[kX] + j);
+            float4 l5 = simd::load4f(lanes[kY] + j);
+            simd::store(lanes[kLocal] + j, l0);
+            simd::store(lanes[kLocal + 1] + j, l1);
+            simd::store(lanes[kLocal + 2] + j, l2);
+            simd::store(lanes[kLocal + 3] + j, l3);
+            simd::store(lanes[kLocal + 4] + j, l4);
+            simd::store(lanes[kLocal + 5] + j, l5);
+
+            float4 p0 = simd::load4f(lanes[kParent] + j);
+            float4 p1 = simd::load4f(lanes[kParent + 1] + j);
+            float4 p2 = simd::load4f(lanes[kParent + 2] + j);
+            float4 p3 = simd::load4f(lanes[kParent + 3] + j);
+            float4 p4 = simd::load4f(lanes[kParent + 4] + j);
+            float4 p5 = simd::load4f(lanes[kParent + 5] + j);
+            simd::store(lanes[kWorld] + j, p0 * l0 + p2 * l1);
+            simd::store(lanes[kWorld + 1] + j, p1 * l0 + p3 * l1);
+            simd::store(lanes[kWorld + 2] + j, p0 * l2 + p2 * l3);
+            simd::store(lanes[kWorld + 3] + j, p1 * l2 + p3 * l3);
+            simd::store(lanes[kWorld + 4] + j, p0 * l4 + p2 * l5 + p4);
+            simd::store(lanes[kWorld + 5] + j, p1 * l4 + p3 * l5 + p5);
+        }
+
+        // Scatter, so the next level (and everything else) sees them.
+        for (size_t j = 0; j < count; j++)
+        {
+            auto component = m_Components[m_Dirty[j]];
+            Mat2D& local = component->mutableTransform();
+            Mat2D& world = component->mutableWorldTransform();
+            for (int k = 0; k < 6; k++)
+            {
+                local[k] = lanes[kLocal + k][j];
+                world[k] = lanes[kWorld + k][j];
+            }
+            RIVE_PROFILE_COMPONENT_UPDATE(component->m_Dirt & transformDirt);
+            component->m_Dirt &= ~transformDirt;
+            if (component->m_Dirt == ComponentDirt::None)
+            {
+                uint32_t graphOrder = m_GraphOrders[m_Dirty[j]];
+                dirtyComponents[graphOrder / 64] &= ~(uint64_t(1) << (graphOrder % 64));
+            }
+        }
+    }
+    return didUpdate;
+}
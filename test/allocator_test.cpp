@@ -0,0 +1,127 @@
+#include <rive/allocator.hpp>
+#include <rive/file.hpp>
+#include <rive/animation/state_machine_instance.hpp>
+#include <rive/animation/state_machine_input_instance.hpp>
+#include "rive_file_reader.hpp"
+#include <catch.hpp>
+#include <cstdlib>
+#include <unordered_set>
+
+namespace
+{
+class CountingAllocator : public rive::Allocator
+{
+public:
+    int* outstanding;
+    int* total;
+    std::unordered_set<void*> blocks;
+    CountingAllocator(int* outstanding, int* total) : outstanding(outstanding), total(total) {}
+
+    void* allocate(size_t size) override
+    {
+        (*outstanding)++;
+        (*total)++;
+        void* block = malloc(size);
+        blocks.insert(block);
+        return block;
+    }
+
+    void deallocate(void* ptr, size_t size) override
+    {
+        REQUIRE(blocks.erase(ptr) == 1);
+        (*outstanding)--;
+        free(ptr);
+    }
+};
+} // namespace
+
+TEST_CASE("arena allocator recycles freed blocks", "[allocator]")
+{
+    rive::ArenaAllocator arena(1024);
+    void* a = arena.allocate(48);
+    void* b = arena.allocate(48);
+    REQUIRE(a != b);
+    REQUIRE(arena.chunkCount() == 1);
+
+    arena.deallocate(a, 48);
+    REQUIRE(arena.allocate(48) == a);
+    REQUIRE(arena.allocate(48) != a);
+
+    // Large allocations don't come from the chunks.
+    void* large = arena.allocate(64 * 1024);
+    REQUIRE(arena.chunkCount() == 1);
+    arena.deallocate(large, 64 * 1024);
+
+    // Chunks grow as they fill up.
+    for (int i = 0; i < 100; i++)
+    {
+        arena.allocate(64);
+    }
+    REQUIRE(arena.chunkCount() > 1);
+    REQUIRE(arena.chunkCount() < 5);
+}
+
+TEST_CASE("artboard instances allocate from their allocator", "[allocator]")
+{
+    auto file = ReadRiveFile("../../test/assets/multiple_state_machines.riv");
+
+    int outstanding = 0;
+    int total = 0;
+    {
+        auto allocator = rive::make_rcp<CountingAllocator>(&outstanding, &total);
+        auto artboard = file->artboard()->instance(allocator);
+        REQUIRE(artboard->allocator() == allocator.get());
+        // Every cloned object comes from the allocator, the artboard itself
+        // from the heap.
+        REQUIRE(allocator->blocks.count(artboard.get()) == 0);
+        size_t cloneCount = 0;
+        for (auto object : artboard->objects())
+        {
+            if (object != nullptr && object != artboard.get())
+            {
+                REQUIRE(allocator->blocks.count(object) == 1);
+                cloneCount++;
+            }
+        }
+        REQUIRE(cloneCount > 0);
+        REQUIRE(total >= (int)cloneCount);
+
+        int clonesTotal = total;
+        auto machine = artboard->stateMachineAt(0);
+        REQUIRE(machine != nullptr);
+        REQUIRE(total > clonesTotal);
+        machine->advanceAndApply(0.0f);
+
+        // The clones are returned when the instance is destroyed, the scene
+        // keeps the allocator alive so it's safe to destroy it after.
+        artboard = nullptr;
+        REQUIRE(outstanding > 0);
+        REQUIRE(outstanding <= total - clonesTotal);
+    }
+    REQUIRE(outstanding == 0);
+}
+
+TEST_CASE("artboard instances default to an arena", "[allocator]")
+{
+    auto file = ReadRiveFile("../../test/assets/light_switch.riv");
+
+    auto artboard = file->artboardDefault();
+    REQUIRE(artboard->allocator() != nullptr);
+    REQUIRE(file->artboard()->allocator() == nullptr);
+
+    auto arena = static_cast<rive::ArenaAllocator*>(artboard->allocator());
+    auto chunkCount = arena->chunkCount();
+    REQUIRE(chunkCount > 0);
+    auto machine = artboard->stateMachineAt(0);
+    machine->advanceAndApply(0.0f);
+    REQUIRE(arena->chunkCount() <= chunkCount + 1);
+
+    // A rig's hundreds of cloned objects are a few chunks rather than an
+    // allocation each.
+    auto rigFile = ReadRiveFile("../../test/assets/bullet_man.riv");
+    auto rig = rigFile->artboardDefault();
+    auto rigArena = static_cast<rive::ArenaAllocator*>(rig->allocator());
+    REQUIRE(rig->objects().size() > 500);
+    REQUIRE(rigArena->chunkCount() > 0);
+    REQUIRE(rigArena->chunkCount() <= 8);
+}
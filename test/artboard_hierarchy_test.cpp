@@ -0,0 +1,131 @@
+#include <rive/artboard.hpp>
+#include <rive/file.hpp>
+#include <rive/node.hpp>
+#include <rive/shapes/clipping_shape.hpp>
+#include <rive/shapes/rectangle.hpp>
+#include <rive/shapes/shape.hpp>
+#include <utils/no_op_factory.hpp>
+#include "catch.hpp"
+#include "rive_file_reader.hpp"
+#include <cstdio>
+
+// The ids of the objects with component in their parent chain.
+static std::vector<uint32_t> walkParents(rive::Artboard* artboard, rive::Component* component)
+{
+    std::vector<uint32_t> ids;
+    auto& objects = artboard->objects();
+    for (size_t i = 0; i < objects.size(); i++)
+    {
+        if (objects[i] == nullptr || !objects[i]->is<rive::Component>())
+        {
+            continue;
+        }
+        for (rive::Component* parent = objects[i]->as<rive::Component>(); parent != nullptr;
+             parent = parent->parent())
+        {
+            if (parent == component)
+            {
+                ids.push_back((uint32_t)i);
+                break;
+            }
+        }
+    }
+    return ids;
+}
+
+TEST_CASE("subtrees match walking up the parents", "[artboard]")
+{
+    const char* paths[] = {
+        "../../test/assets/complex_ik_dependency.riv",
+        "../../test/assets/zombie_skins.riv",
+        "../../test/assets/circle_clips.riv",
+        "../../test/assets/juice.riv",
+    };
+    for (auto path : paths)
+    {
+        auto file = ReadRiveFile(path);
+        auto source = file->artboard();
+        auto instance = source->instance();
+        for (rive::Artboard* artboard : {source, (rive::Artboard*)instance.get()})
+        {
+            for (auto object : artboard->objects())
+            {
+                if (object == nullptr || !object->is<rive::Component>())
+                {
+                    continue;
+                }
+                auto component = object->as<rive::Component>();
+                std::vector<uint32_t> ids;
+                artboard->subtreeIds(component, ids);
+                REQUIRE(ids == walkParents(artboard, component));
+            }
+        }
+    }
+}
+
+// An artboard of groupCount nodes, each holding a rectangle clipped by
+// itself.
+static std::unique_ptr<rive::Artboard> makeClippedGroups(rive::Factory* factory, int groupCount)
+{
+    std::unique_ptr<rive::Artboard> artboard(new rive::Artboard(factory));
+    artboard->addObject(artboard.get());
+    for (int i = 0; i < groupCount; i++)
+    {
+        uint32_t nodeId = (uint32_t)artboard->objects().size();
+        auto node = new rive::Node();
+        auto shape = new rive::Shape();
+        shape->parentId(nodeId);
+        auto rectangle = new rive::Rectangle();
+        rectangle->parentId(nodeId + 1);
+        auto clip = new rive::ClippingShape();
+        clip->parentId(nodeId);
+        clip->sourceId(nodeId + 1);
+        artboard->addObject(node);
+        artboard->addObject(shape);
+        artboard->addObject(rectangle);
+        artboard->addObject(clip);
+    }
+    return artboard;
+}
+
+TEST_CASE("clipping shapes find what they clip in large artboards", "[artboard]")
+{
+    rive::NoOpFactory factory;
+    auto artboard = makeClippedGroups(&factory, 100);
+    REQUIRE(artboard->initialize() == rive::StatusCode::Ok);
+    for (auto object : artboard->objects())
+    {
+        if (object->is<rive::ClippingShape>())
+        {
+            // Just the shape of its own group.
+            auto clip = object->as<rive::ClippingShape>();
+            REQUIRE(clip->shapes().size() == 1);
+            REQUIRE(clip->shapes()[0]->parent() == clip->parent());
+            REQUIRE(clip->shapes()[0]->clippingShapes().size() == 1);
+            REQUIRE(clip->shapes()[0]->clippingShapes()[0] == clip);
+        }
+    }
+}
+
+TEST_CASE("benchmark initializing large artboards", "[.benchmark]")
+{
+    rive::NoOpFactory factory;
+    for (int groupCount : {250, 1000, 4000})
+    {
+        BENCHMARK_ADVANCED("initialize " + std::to_string(groupCount * 4) + " objects")
+        (Catch::Benchmark::Chronometer meter)
+        {
+            std::vector<std::unique_ptr<rive::Artboard>> artboards;
+            for (int i = 0; i < meter.runs(); i++)
+            {
+                artboards.push_back(makeClippedGroups(&factory, groupCount));
+            }
+            meter.measure([&](int i) { return artboards[i]->initialize(); });
+        };
+    }
+    for (auto path : {"complex_ik_dependency.riv", "zombie_skins.riv"})
+    {
+        auto file = ReadRiveFile((std::string("../../test/assets/") + path).c_str());
+        BENCHMARK(std::string("instance ") + path) { return file->artboardDefault(); };
+    }
+}
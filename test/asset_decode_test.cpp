@@ -0,0 +1,143 @@
+#include <rive/file.hpp>
+#include <rive/worker_pool.hpp>
+#include <rive/shapes/image.hpp>
+#include <rive/assets/image_asset.hpp>
+#include <rive/importers/backboard_importer.hpp>
+#include <rive/file_asset_resolver.hpp>
+#include <utils/no_op_factory.hpp>
+#include "catch.hpp"
+#include "rive_file_reader.hpp"
+#include <atomic>
+#include <cstdio>
+
+// Records which threads decode images, each decode taking a while so they
+// overlap.
+class SlowDecodeFactory : public rive::NoOpFactory
+{
+public:
+    std::mutex mutex;
+    std::vector<std::thread::id> threads;
+    std::atomic<uint32_t> checksum{0};
+    int passes = 1;
+
+    std::unique_ptr<rive::RenderImage> decodeImage(rive::Span<const uint8_t> bytes) override
+    {
+        uint32_t sum = 0;
+        for (int pass = 0; pass < passes; pass++)
+        {
+            for (uint8_t byte : bytes)
+            {
+                sum = sum * 31 + byte;
+            }
+        }
+        checksum += sum;
+        std::lock_guard<std::mutex> lock(mutex);
+        threads.push_back(std::this_thread::get_id());
+        return nullptr;
+    }
+};
+
+class CountingResolver : public rive::FileAssetResolver
+{
+public:
+    int loaded = 0;
+    void loadContents(rive::FileAsset& asset) override { loaded++; }
+};
+
+static std::vector<uint8_t> readBytes(const char* path)
+{
+    FILE* fp = fopen(path, "rb");
+    REQUIRE(fp != nullptr);
+    fseek(fp, 0, SEEK_END);
+    const size_t length = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    std::vector<uint8_t> bytes(length);
+    REQUIRE(fread(bytes.data(), 1, length, fp) == length);
+    fclose(fp);
+    return bytes;
+}
+
+TEST_CASE("worker pools run every job", "[executor]")
+{
+    std::atomic<int> count{0};
+    {
+        rive::WorkerPool pool(3);
+        REQUIRE(pool.threadCount() == 3);
+        for (int i = 0; i < 100; i++)
+        {
+            pool.execute([&count]() { count++; });
+        }
+    }
+    REQUIRE(count == 100);
+    rive::WorkerPool defaultPool;
+    REQUIRE(defaultPool.threadCount() >= 1);
+}
+
+TEST_CASE("assets can be decoded on an executor", "[assets]")
+{
+    auto bytes = readBytes("../../test/assets/walle.riv");
+    rive::WorkerPool pool(2);
+    SlowDecodeFactory factory;
+    CountingResolver resolver;
+    rive::ImportOptions options;
+    options.assetDecodeExecutor = &pool;
+    rive::ImportResult result;
+    auto file = rive::File::import(bytes, &factory, &result, &resolver, options);
+    REQUIRE(result == rive::ImportResult::success);
+    REQUIRE(file != nullptr);
+
+    // Every image was decoded by the time import returned, off the importing
+    // thread.
+    REQUIRE(factory.threads.size() == 2);
+    for (auto thread : factory.threads)
+    {
+        REQUIRE(thread != std::this_thread::get_id());
+    }
+    auto walle = file->artboard()->find<rive::Image>("walle");
+    REQUIRE(walle != nullptr);
+    REQUIRE(walle->imageAsset() != nullptr);
+    REQUIRE(walle->imageAsset()->decodedByteSize == 218873);
+
+    // Assets that fail to decode still fall back to the resolver, as they do
+    // when decoded while importing.
+    REQUIRE(resolver.loaded == 2);
+    SlowDecodeFactory serialFactory;
+    CountingResolver serialResolver;
+    rive::File::import(bytes, &serialFactory, nullptr, &serialResolver);
+    REQUIRE(serialResolver.loaded == 2);
+    REQUIRE(serialFactory.checksum == factory.checksum);
+}
+
+TEST_CASE("duplicate asset ids are renamed as each asset is added", "[assets]")
+{
+    rive::BackboardImporter importer(nullptr);
+    uint32_t ids[] = {5, 5, 6, 1, 5};
+    uint32_t expected[] = {5, 6, 7, 1, 8};
+    std::vector<std::unique_ptr<rive::ImageAsset>> assets;
+    for (int i = 0; i < 5; i++)
+    {
+        assets.emplace_back(new rive::ImageAsset());
+        assets.back()->assetId(ids[i]);
+        importer.addFileAsset(assets.back().get());
+        // Assets added before (whose contents may be decoding) keep their id.
+        for (int j = 0; j <= i; j++)
+        {
+            REQUIRE(assets[j]->assetId() == expected[j]);
+        }
+    }
+}
+
+TEST_CASE("benchmark parallel asset decoding", "[.benchmark]")
+{
+    auto bytes = readBytes("../../test/assets/walle.riv");
+    SlowDecodeFactory factory;
+    factory.passes = 20;
+    rive::WorkerPool pool(2);
+    rive::ImportOptions options;
+    options.assetDecodeExecutor = &pool;
+    BENCHMARK("decode while importing") { return rive::File::import(bytes, &factory); };
+    BENCHMARK("decode on a worker pool")
+    {
+        return rive::File::import(bytes, &factory, nullptr, nullptr, options);
+    };
+}
@@ -66,3 +66,23 @@ TEST_CASE("range checks", "[binary_reader]")
     REQUIRE(!checkAs<uint16_t>(100000));
     REQUIRE(checkAs<uint32_t>(100000));
 }
+
+TEST_CASE("strings and bytes are read in place", "[binary_reader]")
+{
+    uint8_t storage[] = {5, 'h', 'e', 'l', 'l', 'o', 3, 1, 2, 3, 4, 'a', 'b'};
+    rive::BinaryReader reader(rive::make_span(storage, sizeof(storage)));
+    REQUIRE(reader.readString() == "hello");
+    auto bytes = reader.readBytes();
+    REQUIRE(bytes.data() == storage + 7);
+    REQUIRE(bytes.size() == 3);
+    REQUIRE(!reader.hasError());
+
+    // Lengths past the end overflow rather than reading out of bounds.
+    REQUIRE(reader.readString() == "");
+    REQUIRE(reader.didOverflow());
+    REQUIRE(reader.reachedEnd());
+
+    rive::BinaryReader bytesReader(rive::make_span(storage + 10, 3));
+    REQUIRE(bytesReader.readBytes().size() == 0);
+    REQUIRE(bytesReader.didOverflow());
+}
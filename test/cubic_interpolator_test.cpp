@@ -0,0 +1,152 @@
+#include <rive/animation/cubic_ease_interpolator.hpp>
+#include "catch.hpp"
+#include <cmath>
+#include <vector>
+
+static void makeEase(rive::CubicEaseInterpolator& ease, float x1, float y1, float x2, float y2)
+{
+    ease.x1(x1);
+    ease.y1(y1);
+    ease.x2(x2);
+    ease.y2(y2);
+    ease.onAddedDirty(nullptr);
+}
+
+// Builds inverse tables for the interpolators resolved in its scope.
+class InverseTables
+{
+public:
+    InverseTables() { rive::CubicInterpolator::enableInverseTables(true); }
+    ~InverseTables() { rive::CubicInterpolator::enableInverseTables(false); }
+};
+
+TEST_CASE("inverse tables are opt-in", "[animation]")
+{
+    REQUIRE(!rive::CubicInterpolator::inverseTablesEnabled());
+    rive::CubicEaseInterpolator ease;
+    makeEase(ease, 0.42f, 0.0f, 0.58f, 1.0f);
+    REQUIRE(!ease.hasInverseTable());
+    {
+        InverseTables tables;
+        makeEase(ease, 0.42f, 0.0f, 0.58f, 1.0f);
+        REQUIRE(ease.hasInverseTable());
+    }
+    makeEase(ease, 0.42f, 0.0f, 0.58f, 1.0f);
+    REQUIRE(!ease.hasInverseTable());
+}
+
+TEST_CASE("inverse table stays within its max error of the solver", "[animation]")
+{
+    InverseTables tables;
+    const float maxError = rive::CubicInterpolator::InverseTableMaxError;
+    int withTable = 0;
+    int total = 0;
+    for (int i = 0; i <= 20; i++)
+    {
+        for (int j = 0; j <= 20; j++)
+        {
+            rive::CubicEaseInterpolator ease;
+            makeEase(ease, i / 20.0f, 0.1f, j / 20.0f, 1.0f);
+            total++;
+            if (!ease.hasInverseTable())
+            {
+                continue;
+            }
+            withTable++;
+            for (int k = 0; k <= 1000; k++)
+            {
+                float x = k / 1000.0f;
+                REQUIRE(std::abs(ease.tableT(x) - ease.solvedT(x)) <= maxError);
+            }
+        }
+    }
+    // Only the steepest curves fall back to the solver.
+    REQUIRE(withTable > total * 3 / 4);
+
+    // Common easing curves all get a table.
+    rive::CubicEaseInterpolator ease;
+    makeEase(ease, 0.42f, 0.0f, 0.58f, 1.0f);
+    REQUIRE(ease.hasInverseTable());
+    makeEase(ease, 0.25f, 0.1f, 0.25f, 1.0f);
+    REQUIRE(ease.hasInverseTable());
+}
+
+TEST_CASE("batched easing matches transform", "[animation]")
+{
+    InverseTables tables;
+    std::vector<rive::CubicEaseInterpolator> eases(7);
+    // Includes a curve too steep for the table.
+    makeEase(eases[0], 0.0f, 0.0f, 0.0f, 1.0f);
+    REQUIRE(!eases[0].hasInverseTable());
+    for (size_t i = 1; i < eases.size(); i++)
+    {
+        makeEase(eases[i], i / 8.0f, 0.2f, 1.0f - i / 10.0f, 0.9f);
+    }
+
+    std::vector<const rive::CubicEaseInterpolator*> interpolators;
+    std::vector<float> factors;
+    for (int i = 0; i < 101; i++)
+    {
+        interpolators.push_back(&eases[i % eases.size()]);
+        factors.push_back(i / 100.0f);
+    }
+    std::vector<float> results(factors.size());
+    rive::CubicEaseInterpolator::transform(interpolators.data(),
+                                           factors.data(),
+                                           results.data(),
+                                           factors.size());
+    for (size_t i = 0; i < factors.size(); i++)
+    {
+        REQUIRE(results[i] == Approx(interpolators[i]->transform(factors[i])).margin(1e-6f));
+    }
+}
+
+TEST_CASE("benchmark cubic easing", "[.benchmark]")
+{
+    InverseTables tables;
+    rive::CubicEaseInterpolator ease;
+    makeEase(ease, 0.42f, 0.0f, 0.58f, 1.0f);
+    const int count = 1024;
+    std::vector<const rive::CubicEaseInterpolator*> interpolators(count, &ease);
+    std::vector<float> factors(count);
+    std::vector<float> results(count);
+    for (int i = 0; i < count; i++)
+    {
+        factors[i] = i / (float)(count - 1);
+    }
+
+    BENCHMARK("solver")
+    {
+        float sum = 0.0f;
+        for (float x : factors)
+        {
+            sum += ease.solvedT(x);
+        }
+        return sum;
+    };
+    BENCHMARK("inverse table")
+    {
+        float sum = 0.0f;
+        for (float x : factors)
+        {
+            sum += ease.tableT(x);
+        }
+        return sum;
+    };
+    BENCHMARK("transform")
+    {
+        for (int i = 0; i < count; i++)
+        {
+            results[i] = ease.transform(factors[i]);
+        }
+        return results[count / 2];
+    };
+    BENCHMARK("batched transform")
+    {
+        rive::CubicEaseInterpolator::transform(interpolators.data(),
+                                               factors.data(),
+                                               results.data(),
+                                               count);
+        return results[count / 2];
+    };
+}
@@ -0,0 +1,172 @@
+#include <rive/file.hpp>
+#include <rive/file_metadata.hpp>
+#include <rive/animation/linear_animation.hpp>
+#include <rive/animation/state_machine.hpp>
+#include <rive/animation/state_machine_input.hpp>
+#include <rive/assets/file_asset.hpp>
+#include <rive/assets/image_asset.hpp>
+#include <rive/backboard.hpp>
+#include "catch.hpp"
+#include "rive_file_reader.hpp"
+#include <cstdio>
+
+static std::vector<uint8_t> readBytes(const char* path)
+{
+    FILE* fp = fopen(path, "rb");
+    REQUIRE(fp != nullptr);
+    fseek(fp, 0, SEEK_END);
+    const size_t length = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    std::vector<uint8_t> bytes(length);
+    REQUIRE(fread(bytes.data(), 1, length, fp) == length);
+    fclose(fp);
+    return bytes;
+}
+
+TEST_CASE("scanned metadata matches the imported file", "[file]")
+{
+    const char* paths[] = {
+        "../../test/assets/two_artboards.riv",
+        "../../test/assets/walle.riv",
+        "../../test/assets/out_of_band/walle.riv",
+        "../../test/assets/death_knight.riv",
+        "../../test/assets/multiple_state_machines.riv",
+        "../../test/assets/juice.riv",
+        "../../test/assets/new_text.riv",
+        "../../test/assets/light_switch.riv",
+    };
+    for (auto path : paths)
+    {
+        auto bytes = readBytes(path);
+        auto file = rive::File::import(bytes, &gNoOpFactory);
+        REQUIRE(file != nullptr);
+        rive::FileMetadata metadata;
+        REQUIRE(rive::FileMetadata::scan(bytes, &metadata) == rive::ImportResult::success);
+
+        REQUIRE(metadata.artboards.size() == file->artboardCount());
+        for (size_t i = 0; i < file->artboardCount(); i++)
+        {
+            auto artboard = file->artboard(i);
+            auto& scanned = metadata.artboards[i];
+            REQUIRE(scanned.name == artboard->name());
+            REQUIRE(scanned.width == artboard->width());
+            REQUIRE(scanned.height == artboard->height());
+
+            REQUIRE(scanned.animations.size() == artboard->animationCount());
+            for (size_t j = 0; j < artboard->animationCount(); j++)
+            {
+                auto animation = artboard->animation(j);
+                REQUIRE(scanned.animations[j].name == animation->name());
+                REQUIRE(scanned.animations[j].durationSeconds() == animation->durationSeconds());
+                REQUIRE(scanned.animations[j].loopValue == animation->loopValue());
+                REQUIRE(scanned.animations[j].speed == animation->speed());
+            }
+
+            REQUIRE(scanned.stateMachines.size() == artboard->stateMachineCount());
+            for (size_t j = 0; j < artboard->stateMachineCount(); j++)
+            {
+                auto machine = artboard->stateMachine(j);
+                REQUIRE(scanned.stateMachines[j].name == machine->name());
+                REQUIRE(scanned.stateMachines[j].inputs.size() == machine->inputCount());
+                for (size_t k = 0; k < machine->inputCount(); k++)
+                {
+                    REQUIRE(scanned.stateMachines[j].inputs[k].name == machine->input(k)->name());
+                    REQUIRE(scanned.stateMachines[j].inputs[k].coreType ==
+                            machine->input(k)->coreType());
+                }
+            }
+        }
+
+        auto assets = file->assets();
+        REQUIRE(metadata.assets.size() == assets.size());
+        for (size_t i = 0; i < assets.size(); i++)
+        {
+            REQUIRE(metadata.assets[i].name == assets[i]->name());
+            REQUIRE(metadata.assets[i].coreType == assets[i]->coreType());
+            REQUIRE(metadata.assets[i].assetId == assets[i]->assetId());
+            REQUIRE(metadata.assets[i].inBand == (metadata.assets[i].contentsSize != 0));
+        }
+    }
+}
+
+TEST_CASE("scanning reports in band asset contents", "[file]")
+{
+    rive::FileMetadata metadata;
+    auto inBand = readBytes("../../test/assets/walle.riv");
+    REQUIRE(rive::FileMetadata::scan(inBand, &metadata) == rive::ImportResult::success);
+    REQUIRE(metadata.assets.size() == 2);
+    REQUIRE(metadata.assets[0].inBand);
+    REQUIRE(metadata.assets[0].contentsSize == 218873);
+    REQUIRE(metadata.assets[1].contentsSize == 246825);
+
+    auto outOfBand = readBytes("../../test/assets/out_of_band/walle.riv");
+    REQUIRE(rive::FileMetadata::scan(outOfBand, &metadata) == rive::ImportResult::success);
+    REQUIRE(metadata.assets.size() == 2);
+    REQUIRE(!metadata.assets[0].inBand);
+
+    uint8_t garbage[] = {'R', 'I', 'V', 'E', 1};
+    REQUIRE(rive::FileMetadata::scan(rive::make_span(garbage, sizeof(garbage)), &metadata) !=
+            rive::ImportResult::success);
+}
+
+static void writeVarUint(std::vector<uint8_t>& bytes, uint64_t value)
+{
+    do
+    {
+        uint8_t byte = value & 0x7F;
+        value >>= 7;
+        bytes.push_back(value != 0 ? byte | 0x80 : byte);
+    } while (value != 0);
+}
+
+TEST_CASE("scanning renames duplicate asset ids as importing does", "[file]")
+{
+    std::vector<uint8_t> bytes = {'R', 'I', 'V', 'E'};
+    writeVarUint(bytes, rive::File::majorVersion);
+    writeVarUint(bytes, rive::File::minorVersion);
+    writeVarUint(bytes, 0); // file id
+    writeVarUint(bytes, 0); // no property toc
+    writeVarUint(bytes, rive::BackboardBase::typeKey);
+    writeVarUint(bytes, 0);
+    for (uint32_t assetId : {5, 5, 6, 1, 5})
+    {
+        writeVarUint(bytes, rive::ImageAssetBase::typeKey);
+        writeVarUint(bytes, rive::FileAssetBase::assetIdPropertyKey);
+        writeVarUint(bytes, assetId);
+        writeVarUint(bytes, 0);
+    }
+
+    rive::FileMetadata metadata;
+    REQUIRE(rive::FileMetadata::scan(bytes, &metadata) == rive::ImportResult::success);
+    uint32_t expected[] = {5, 6, 7, 1, 8};
+    REQUIRE(metadata.assets.size() == 5);
+    for (int i = 0; i < 5; i++)
+    {
+        REQUIRE(metadata.assets[i].assetId == expected[i]);
+    }
+
+    auto file = rive::File::import(bytes, &gNoOpFactory);
+    REQUIRE(file != nullptr);
+    REQUIRE(file->assets().size() == 5);
+    for (int i = 0; i < 5; i++)
+    {
+        REQUIRE(file->assets()[i]->assetId() == expected[i]);
+    }
+}
+
+TEST_CASE("benchmark scanning metadata", "[.benchmark]")
+{
+    for (auto path : {"death_knight.riv", "walle.riv", "multiple_state_machines.riv"})
+    {
+        auto bytes = readBytes((std::string("../../test/assets/") + path).c_str());
+        BENCHMARK(std::string("import ") + path)
+        {
+            return rive::File::import(bytes, &gNoOpFactory);
+        };
+        BENCHMARK(std::string("scan ") + path)
+        {
+            rive::FileMetadata metadata;
+            return rive::FileMetadata::scan(bytes, &metadata);
+        };
+    }
+}
@@ -2,11 +2,19 @@
  * Copyright 2022 Rive
  */
 
+#include <rive/artboard.hpp>
 #include <rive/math/aabb.hpp>
 #include <rive/math/hit_test.hpp>
+#include <rive/shapes/rectangle.hpp>
+#include <rive/shapes/shape.hpp>
+#include <utils/no_op_factory.hpp>
 
 #include <catch.hpp>
+#include <algorithm>
+#include <cmath>
 #include <cstdio>
+#include <string>
+#include <vector>
 
 using namespace rive;
 
@@ -57,3 +65,330 @@ TEST_CASE("hittest-mesh", "[hittest]")
     };
     REQUIRE(HitTester::testMesh(area, make_span(verts, 3), make_span(indices, 3)));
 }
+
+namespace
+{
+// Straightforward version of HitTester for lines: a winding buffer allocated
+// per test, filled one row at a time.
+class ReferenceHitTester
+{
+    std::vector<int> m_DW;
+    int m_Width, m_Height;
+    Vec2D m_Offset, m_First, m_Prev;
+
+public:
+    ReferenceHitTester(const IAABB& area) :
+        m_DW(area.width() * area.height()),
+        m_Width(area.width()),
+        m_Height(area.height()),
+        m_Offset((float)area.left, (float)area.top)
+    {}
+
+    void move(Vec2D v) { m_First = m_Prev = v - m_Offset; }
+    void line(Vec2D v)
+    {
+        v = v - m_Offset;
+        Vec2D p0 = m_Prev, p1 = v;
+        m_Prev = v;
+        if (p0.y == p1.y)
+        {
+            return;
+        }
+        int winding = 1;
+        if (p0.y > p1.y)
+        {
+            winding = -1;
+            std::swap(p0, p1);
+        }
+        float height = (float)m_Height;
+        if (p1.y <= 0 || p0.y >= height)
+        {
+            return;
+        }
+        float m = (p1.x - p0.x) / (p1.y - p0.y);
+        if (p0.y < 0)
+        {
+            p0.x += m * (0 - p0.y);
+            p0.y = 0;
+        }
+        if (p1.y > height)
+        {
+            p1.x += m * (height - p1.y);
+            p1.y = height;
+        }
+        int top = (int)std::floor(p0.y + 0.5f);
+        int bottom = (int)std::floor(p1.y + 0.5f);
+        float x = p0.x + m * (top - p0.y + 0.5f) + 0.5f;
+        for (int y = top; y < bottom; ++y)
+        {
+            int ix = (int)std::min(std::max(x + m * (y - top), 0.0f), (float)m_Width);
+            if (ix < m_Width)
+            {
+                m_DW[y * m_Width + ix] += winding;
+            }
+        }
+    }
+    void close() { line(m_First + m_Offset); }
+
+    bool test(FillRule rule)
+    {
+        const int mask = (rule == rive::FillRule::nonZero) ? -1 : 1;
+        int nonzero = 0;
+        for (auto m : m_DW)
+        {
+            nonzero |= (m & mask);
+        }
+        return nonzero != 0;
+    }
+};
+
+class Random
+{
+    uint32_t m_State;
+
+public:
+    Random(uint32_t seed) : m_State(seed) {}
+    float next(float min, float max)
+    {
+        m_State = m_State * 1664525u + 1013904223u;
+        return min + (max - min) * ((m_State >> 8) / (float)(1 << 24));
+    }
+};
+
+template <typename Tester> void testPolygon(Tester& tester, const std::vector<Vec2D>& points)
+{
+    tester.move(points[0]);
+    for (size_t i = 1; i < points.size(); i++)
+    {
+        tester.line(points[i]);
+    }
+    tester.close();
+}
+
+// points[0] then a cubic to every third point after it.
+void testCurves(HitTester& tester, const std::vector<Vec2D>& points)
+{
+    tester.move(points[0]);
+    for (size_t i = 1; i + 2 < points.size(); i += 3)
+    {
+        tester.cubic(points[i], points[i + 1], points[i + 2]);
+    }
+    tester.close();
+}
+} // namespace
+
+TEST_CASE("hittest matches the reference for small and large areas", "[hittest]")
+{
+    Random random(7);
+    HitTester tester;
+    int hits = 0;
+    for (int i = 0; i < 2000; i++)
+    {
+        std::vector<Vec2D> points(3 + (int)random.next(0, 10));
+        for (auto& point : points)
+        {
+            point = Vec2D(random.next(0, 50), random.next(0, 50));
+        }
+        int left = (int)random.next(-5, 50);
+        int top = (int)random.next(-5, 50);
+        // Mostly small areas (kept inline), some larger ones.
+        int size = i % 8 == 0 ? 8 + (int)random.next(0, 30) : 1 + (int)random.next(0, 6);
+        IAABB area = {left, top, left + size, top + size};
+        for (auto rule : {FillRule::nonZero, FillRule::evenOdd})
+        {
+            tester.reset(area);
+            testPolygon(tester, points);
+            ReferenceHitTester reference(area);
+            testPolygon(reference, points);
+            bool hit = tester.test(rule);
+            REQUIRE(hit == reference.test(rule));
+            hits += hit ? 1 : 0;
+        }
+    }
+    REQUIRE(hits > 0);
+}
+
+TEST_CASE("points and tiny areas match rasterizing them", "[hittest]")
+{
+    Random random(11);
+    HitTester analytic;
+    HitTester rasterized;
+    rasterized.useAnalyticAreas(false);
+    int hits = 0;
+    for (int i = 0; i < 2000; i++)
+    {
+        std::vector<Vec2D> points(1 + 3 * (1 + (int)random.next(0, 4)));
+        for (auto& point : points)
+        {
+            point = Vec2D(random.next(0, 50), random.next(0, 50));
+        }
+        int left = (int)random.next(-5, 50);
+        int top = (int)random.next(-5, 50);
+        IAABB areas[] = {
+            {left, top, left + 1, top + 1},
+            {left, top, left + 2, top + 2},
+            {left, top, left + 4, top + 1},
+            {left, top, left + 1, top + 4},
+        };
+        for (auto& area : areas)
+        {
+            for (auto rule : {FillRule::nonZero, FillRule::evenOdd})
+            {
+                analytic.reset(area);
+                testCurves(analytic, points);
+                rasterized.reset(area);
+                testCurves(rasterized, points);
+                bool hit = analytic.test(rule);
+                REQUIRE(hit == rasterized.test(rule));
+                hits += hit ? 1 : 0;
+
+                analytic.reset(area);
+                testPolygon(analytic, points);
+                rasterized.reset(area);
+                testPolygon(rasterized, points);
+                REQUIRE(analytic.test(rule) == rasterized.test(rule));
+            }
+        }
+    }
+    REQUIRE(hits > 0);
+}
+
+TEST_CASE("shapes reuse their hit tester across areas", "[hittest]")
+{
+    NoOpFactory factory;
+    Artboard artboard(&factory);
+    artboard.addObject(&artboard);
+    auto shape = new Shape();
+    shape->x(50.0f);
+    shape->y(50.0f);
+    auto rectangle = new Rectangle();
+    rectangle->parentId(1);
+    rectangle->width(20.0f);
+    rectangle->height(20.0f);
+    artboard.addObject(shape);
+    artboard.addObject(rectangle);
+    REQUIRE(artboard.initialize() == StatusCode::Ok);
+    artboard.advance(0.0f);
+
+    // Alternates between areas kept inline and larger ones.
+    for (int i = 0; i < 2; i++)
+    {
+        REQUIRE(shape->hitTest(IAABB{30, 30, 70, 70}));
+        REQUIRE(!shape->hitTest(IAABB{0, 0, 2, 2}));
+        REQUIRE(shape->hitTest(IAABB{50, 50, 51, 51}));
+        REQUIRE(!shape->hitTest(IAABB{70, 70, 110, 110}));
+        REQUIRE(shape->hitTest(IAABB{58, 58, 62, 62}));
+    }
+}
+
+TEST_CASE("benchmark hittest", "[.benchmark]")
+{
+    // A circle-ish polygon tested at the area a pointer covers.
+    std::vector<Vec2D> points;
+    for (int i = 0; i < 64; i++)
+    {
+        float angle = i * 2.0f * 3.14159265f / 64;
+        points.push_back(Vec2D(200 + 100 * std::cos(angle), 200 + 100 * std::sin(angle)));
+    }
+    std::vector<IAABB> areas;
+    for (int y = 80; y < 320; y += 30)
+    {
+        for (int x = 80; x < 320; x += 30)
+        {
+            areas.push_back({x - 2, y - 2, x + 2, y + 2});
+        }
+    }
+
+    BENCHMARK("reference")
+    {
+        int hits = 0;
+        for (auto& area : areas)
+        {
+            ReferenceHitTester tester(area);
+            testPolygon(tester, points);
+            hits += tester.test(FillRule::nonZero);
+        }
+        return hits;
+    };
+    BENCHMARK("HitTester")
+    {
+        int hits = 0;
+        for (auto& area : areas)
+        {
+            HitTester tester(area);
+            testPolygon(tester, points);
+            hits += tester.test(FillRule::nonZero);
+        }
+        return hits;
+    };
+    BENCHMARK("HitTester large area")
+    {
+        HitTester tester;
+        int hits = 0;
+        for (auto& area : areas)
+        {
+            tester.reset(area.inset(-20, -20));
+            testPolygon(tester, points);
+            hits += tester.test(FillRule::nonZero);
+        }
+        return hits;
+    };
+    // Pointer positions, tested against the polygon and a circle made of
+    // curves.
+    std::vector<Vec2D> circle;
+    const float handle = 0.5522848f * 100;
+    const float quarter = 3.14159265f / 2;
+    circle.push_back(Vec2D(300, 200));
+    for (int i = 0; i < 4; i++)
+    {
+        Vec2D from(std::cos(i * quarter), std::sin(i * quarter));
+        Vec2D to(std::cos((i + 1) * quarter), std::sin((i + 1) * quarter));
+        circle.push_back(Vec2D(200, 200) + from * 100 + Vec2D(-from.y, from.x) * handle);
+        circle.push_back(Vec2D(200, 200) + to * 100 + Vec2D(to.y, -to.x) * handle);
+        circle.push_back(Vec2D(200, 200) + to * 100);
+    }
+    std::vector<IAABB> pointers;
+    for (auto& area : areas)
+    {
+        pointers.push_back({area.left + 2, area.top + 2, area.left + 3, area.top + 3});
+    }
+    for (bool analytic : {true, false})
+    {
+        HitTester tester;
+        tester.useAnalyticAreas(analytic);
+        std::string name = analytic ? "analytic" : "rasterized";
+        BENCHMARK("HitTester point, polygon, " + name)
+        {
+            int hits = 0;
+            for (auto& pointer : pointers)
+            {
+                tester.reset(pointer);
+                testPolygon(tester, points);
+                hits += tester.test(FillRule::nonZero);
+            }
+            return hits;
+        };
+        BENCHMARK("HitTester point, curves, " + name)
+        {
+            int hits = 0;
+            for (auto& pointer : pointers)
+            {
+                tester.reset(pointer);
+                testCurves(tester, circle);
+                hits += tester.test(FillRule::nonZero);
+            }
+            return hits;
+        };
+    }
+    BENCHMARK("reference large area")
+    {
+        int hits = 0;
+        for (auto& area : areas)
+        {
+            ReferenceHitTester tester(area.inset(-20, -20));
+            testPolygon(tester, points);
+            hits += tester.test(FillRule::nonZero);
+        }
+        return hits;
+    };
+}
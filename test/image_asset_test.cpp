@@ -5,6 +5,7 @@
 #include <rive/shapes/image.hpp>
 #include <rive/assets/image_asset.hpp>
 #include <rive/relative_local_asset_resolver.hpp>
+#include <rive/worker_pool.hpp>
 #include <utils/no_op_factory.hpp>
 #include <utils/no_op_renderer.hpp>
 #include "rive_file_reader.hpp"
@@ -79,3 +80,94 @@ TEST_CASE("out of band image assets loads correctly", "[assets]")
     rive::NoOpRenderer renderer;
     file->artboard()->draw(&renderer);
 }
+
+TEST_CASE("missing out of band image assets are skipped", "[assets]")
+{
+    rive::NoOpFactory gEmptyFactory;
+    // Looks for the assets next to a file that isn't where they are.
+    rive::RelativeLocalAssetResolver resolver("../../test/assets/walle.riv", &gEmptyFactory);
+    auto file = ReadRiveFile("../../test/assets/out_of_band/walle.riv", &gEmptyFactory, &resolver);
+
+    auto walle = file->artboard()->find<rive::Image>("walle");
+    REQUIRE(walle != nullptr);
+    REQUIRE(walle->imageAsset() != nullptr);
+    REQUIRE(walle->imageAsset()->decodedByteSize == 0);
+}
+
+static std::vector<uint8_t> readBytes(const char* path)
+{
+    FILE* fp = fopen(path, "rb");
+    REQUIRE(fp != nullptr);
+    fseek(fp, 0, SEEK_END);
+    const size_t length = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    std::vector<uint8_t> bytes(length);
+    REQUIRE(fread(bytes.data(), 1, length, fp) == length);
+    fclose(fp);
+    return bytes;
+}
+
+TEST_CASE("out of band image assets load asynchronously", "[assets]")
+{
+    rive::NoOpFactory gEmptyFactory;
+    std::string filename = "../../test/assets/out_of_band/walle.riv";
+    auto bytes = readBytes(filename.c_str());
+    rive::WorkerPool pool(2);
+    rive::AsyncRelativeLocalAssetResolver resolver(filename, &gEmptyFactory, &pool);
+    rive::ImportOptions options;
+    options.asyncAssetResolver = &resolver;
+    rive::ImportResult result;
+    auto file = rive::File::import(bytes, &gEmptyFactory, &result, nullptr, options);
+    REQUIRE(result == rive::ImportResult::success);
+
+    file->waitForAssets();
+    REQUIRE(!file->assetsPending());
+    auto walle = file->artboard()->find<rive::Image>("walle");
+    REQUIRE(walle->imageAsset()->decodedByteSize == 218873);
+    auto eve = file->artboard()->find<rive::Image>("eve_left");
+    REQUIRE(eve->imageAsset()->decodedByteSize == 246825);
+}
+
+// Holds on to the assets it's asked for until it's told to load them.
+class DeferredAssetResolver : public rive::AsyncFileAssetResolver
+{
+public:
+    std::vector<rive::FileAsset*> assets;
+    std::function<void()> done;
+
+    void loadContents(std::vector<rive::FileAsset*> assets, std::function<void()> done) override
+    {
+        this->assets = assets;
+        this->done = done;
+    }
+};
+
+TEST_CASE("async asset resolvers are given every missing asset at once", "[assets]")
+{
+    auto bytes = readBytes("../../test/assets/out_of_band/walle.riv");
+    DeferredAssetResolver resolver;
+    rive::ImportOptions options;
+    options.asyncAssetResolver = &resolver;
+    auto file = rive::File::import(bytes, &gNoOpFactory, nullptr, nullptr, options);
+    REQUIRE(file != nullptr);
+    REQUIRE(resolver.assets.size() == 2);
+    REQUIRE(file->assetsPending());
+    resolver.done();
+    REQUIRE(!file->assetsPending());
+
+    // In band assets that fail to decode are handed over too.
+    DeferredAssetResolver inBandResolver;
+    options.asyncAssetResolver = &inBandResolver;
+    auto inBandBytes = readBytes("../../test/assets/walle.riv");
+    auto inBand = rive::File::import(inBandBytes, &gNoOpFactory, nullptr, nullptr, options);
+    REQUIRE(inBandResolver.assets.size() == 2);
+    inBandResolver.done();
+
+    // Files without missing assets don't wait on the resolver.
+    DeferredAssetResolver noAssetsResolver;
+    options.asyncAssetResolver = &noAssetsResolver;
+    auto noAssetsBytes = readBytes("../../test/assets/two_artboards.riv");
+    auto noAssets = rive::File::import(noAssetsBytes, &gNoOpFactory, nullptr, nullptr, options);
+    REQUIRE(noAssetsResolver.done == nullptr);
+    REQUIRE(!noAssets->assetsPending());
+}
@@ -0,0 +1,110 @@
+#include <rive/file.hpp>
+#include "catch.hpp"
+#include "rive_file_reader.hpp"
+#include <chrono>
+#include <cstdio>
+
+// Every .riv in test/assets, add new ones here so they're measured too.
+static const char* assetPaths[] = {
+    "artboardclipping.riv",
+    "blend_test.riv",
+    "bullet_man.riv",
+    "circle_clips.riv",
+    "complex_ik_dependency.riv",
+    "cubic_value_test.riv",
+    "death_knight.riv",
+    "dependency_test.riv",
+    "distance_constraint.riv",
+    "draw_rule_cycle.riv",
+    "ellipsis.riv",
+    "entry.riv",
+    "fix_rectangle.riv",
+    "hello_world.riv",
+    "jellyfish_test.riv",
+    "juice.riv",
+    "light_switch.riv",
+    "long_name.riv",
+    "multiple_state_machines.riv",
+    "nested_solo.riv",
+    "new_text.riv",
+    "off_road_car.riv",
+    "oneshotblend.riv",
+    "out_of_band/walle.riv",
+    "rocket.riv",
+    "rotation_constraint.riv",
+    "scale_constraint.riv",
+    "shapetest.riv",
+    "solo_test.riv",
+    "stroke_name_test.riv",
+    "tape.riv",
+    "transform_constraint.riv",
+    "translation_constraint.riv",
+    "trim.riv",
+    "trim_path_linear.riv",
+    "two_artboards.riv",
+    "two_bone_ik.riv",
+    "walle.riv",
+    "zombie_skins.riv",
+};
+
+static std::vector<uint8_t> readAsset(const char* name)
+{
+    FILE* fp = fopen((std::string("../../test/assets/") + name).c_str(), "rb");
+    REQUIRE(fp != nullptr);
+    fseek(fp, 0, SEEK_END);
+    const size_t length = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    std::vector<uint8_t> bytes(length);
+    REQUIRE(fread(bytes.data(), 1, length, fp) == length);
+    fclose(fp);
+    return bytes;
+}
+
+TEST_CASE("benchmark import throughput", "[.benchmark]")
+{
+    std::vector<std::vector<uint8_t>> assets;
+    size_t byteCount = 0;
+    size_t objectCount = 0;
+    for (auto path : assetPaths)
+    {
+        assets.push_back(readAsset(path));
+        byteCount += assets.back().size();
+        auto file = rive::File::import(assets.back(), &gNoOpFactory);
+        REQUIRE(file != nullptr);
+        for (size_t i = 0; i < file->artboardCount(); i++)
+        {
+            objectCount += file->artboard(i)->objects().size();
+        }
+    }
+
+    BENCHMARK("import every asset")
+    {
+        size_t imported = 0;
+        for (auto& bytes : assets)
+        {
+            imported += rive::File::import(bytes, &gNoOpFactory) != nullptr;
+        }
+        return imported;
+    };
+
+    // Catch only reports times, report the throughput too.
+    const int runs = 20;
+    auto start = std::chrono::steady_clock::now();
+    for (int run = 0; run < runs; run++)
+    {
+        for (auto& bytes : assets)
+        {
+            REQUIRE(rive::File::import(bytes, &gNoOpFactory) != nullptr);
+        }
+    }
+    std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+    printf("imported %zu files (%.2f MB, %zu artboard objects) %d times in %.3fs: %.2f MB/s, "
+           "%.0f objects/s\n",
+           assets.size(),
+           byteCount / 1e6,
+           objectCount,
+           runs,
+           seconds.count(),
+           byteCount * runs / 1e6 / seconds.count(),
+           objectCount * runs / seconds.count());
+}
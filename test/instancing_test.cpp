@@ -66,3 +66,37 @@ TEST_CASE("instancing artboard doesn't clone animations", "[instancing]")
     // Now the animations should've been deleted.
     REQUIRE(rive::LinearAnimation::deleteCount == numberOfAnimations);
 }
+
+TEST_CASE("instances reuse the source artboard's sorted order", "[instancing]")
+{
+    auto file = ReadRiveFile("../../test/assets/draw_rule_cycle.riv");
+
+    auto source = file->artboard();
+    auto artboard = file->artboardDefault();
+    auto nested = artboard->instance();
+
+    const auto& sourceObjects = source->objects();
+    REQUIRE(sourceObjects.size() == artboard->objects().size());
+    REQUIRE(sourceObjects.size() == nested->objects().size());
+    for (size_t i = 0; i < sourceObjects.size(); i++)
+    {
+        auto object = sourceObjects[i];
+        if (object == nullptr || !object->is<rive::Component>())
+        {
+            continue;
+        }
+        auto graphOrder = object->as<rive::Component>()->graphOrder();
+        REQUIRE(artboard->objects()[i]->as<rive::Component>()->graphOrder() == graphOrder);
+        REQUIRE(nested->objects()[i]->as<rive::Component>()->graphOrder() == graphOrder);
+    }
+
+    artboard->advance(0.0f);
+    rive::NoOpRenderer renderer;
+    artboard->draw(&renderer);
+}
+
+TEST_CASE("benchmark artboard instancing", "[.benchmark]")
+{
+    auto file = ReadRiveFile("../../test/assets/death_knight.riv");
+    BENCHMARK("instance death_knight") { return file->artboardDefault(); };
+}
@@ -0,0 +1,176 @@
+#include <rive/file.hpp>
+#include <rive/nested_artboard.hpp>
+#include <rive/node.hpp>
+#include <rive/animation/linear_animation_instance.hpp>
+#include <rive/animation/state_machine.hpp>
+#include "catch.hpp"
+#include "rive_file_reader.hpp"
+#include <cstdio>
+
+static std::vector<uint8_t> readBytes(const char* path)
+{
+    FILE* fp = fopen(path, "rb");
+    REQUIRE(fp != nullptr);
+    fseek(fp, 0, SEEK_END);
+    const size_t length = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    std::vector<uint8_t> bytes(length);
+    REQUIRE(fread(bytes.data(), 1, length, fp) == length);
+    fclose(fp);
+    return bytes;
+}
+
+static std::unique_ptr<rive::File> importFile(const std::vector<uint8_t>& bytes,
+                                              bool lazy,
+                                              bool bytesOutliveFile = false)
+{
+    rive::ImportOptions options;
+    options.lazyArtboards = lazy;
+    options.bytesOutliveFile = bytesOutliveFile;
+    rive::ImportResult result;
+    auto file = rive::File::import(bytes, &gNoOpFactory, &result, nullptr, options);
+    REQUIRE(result == rive::ImportResult::success);
+    REQUIRE(file != nullptr);
+    return file;
+}
+
+static void requireSameArtboard(rive::Artboard* eager, rive::Artboard* lazy)
+{
+    REQUIRE(eager->name() == lazy->name());
+    REQUIRE(eager->objects().size() == lazy->objects().size());
+    for (size_t i = 0; i < eager->objects().size(); i++)
+    {
+        auto a = eager->objects()[i];
+        auto b = lazy->objects()[i];
+        REQUIRE((a == nullptr) == (b == nullptr));
+        if (a != nullptr)
+        {
+            REQUIRE(a->coreType() == b->coreType());
+        }
+    }
+    REQUIRE(eager->animationCount() == lazy->animationCount());
+    for (size_t i = 0; i < eager->animationCount(); i++)
+    {
+        REQUIRE(eager->animation(i)->name() == lazy->animation(i)->name());
+        REQUIRE(eager->animation(i)->numKeyedObjects() == lazy->animation(i)->numKeyedObjects());
+    }
+    REQUIRE(eager->stateMachineCount() == lazy->stateMachineCount());
+    for (size_t i = 0; i < eager->stateMachineCount(); i++)
+    {
+        REQUIRE(eager->stateMachine(i)->name() == lazy->stateMachine(i)->name());
+        REQUIRE(eager->stateMachine(i)->layerCount() == lazy->stateMachine(i)->layerCount());
+        REQUIRE(eager->stateMachine(i)->inputCount() == lazy->stateMachine(i)->inputCount());
+    }
+    REQUIRE(eager->nestedArtboards().size() == lazy->nestedArtboards().size());
+    for (size_t i = 0; i < eager->nestedArtboards().size(); i++)
+    {
+        auto a = eager->nestedArtboards()[i]->artboard();
+        auto b = lazy->nestedArtboards()[i]->artboard();
+        REQUIRE((a == nullptr) == (b == nullptr));
+        if (a != nullptr)
+        {
+            REQUIRE(a->name() == b->name());
+            REQUIRE(a->objects().size() == b->objects().size());
+        }
+    }
+
+    // Instances animate the same.
+    auto eagerInstance = eager->instance();
+    auto lazyInstance = lazy->instance();
+    if (eager->animationCount() > 0)
+    {
+        rive::LinearAnimationInstance a(eager->animation(0), eagerInstance.get());
+        rive::LinearAnimationInstance b(lazy->animation(0), lazyInstance.get());
+        a.advanceAndApply(0.25f);
+        b.advanceAndApply(0.25f);
+    }
+    eagerInstance->advance(0.0f);
+    lazyInstance->advance(0.0f);
+    for (size_t i = 0; i < eagerInstance->objects().size(); i++)
+    {
+        auto a = eagerInstance->objects()[i];
+        auto b = lazyInstance->objects()[i];
+        if (a != nullptr && a->is<rive::Node>())
+        {
+            REQUIRE(a->as<rive::Node>()->worldTransform() ==
+                    b->as<rive::Node>()->worldTransform());
+        }
+    }
+}
+
+TEST_CASE("lazily imported artboards match eagerly imported ones", "[file]")
+{
+    const char* paths[] = {
+        "../../test/assets/two_artboards.riv",
+        "../../test/assets/walle.riv",
+        "../../test/assets/tape.riv",
+        "../../test/assets/death_knight.riv",
+        "../../test/assets/nested_solo.riv",
+        "../../test/assets/multiple_state_machines.riv",
+        "../../test/assets/juice.riv",
+    };
+    for (auto path : paths)
+    {
+        auto bytes = readBytes(path);
+        auto eager = importFile(bytes, false);
+        // Lazy artboards either copy their bytes or refer to the imported
+        // ones.
+        for (bool bytesOutliveFile : {false, true})
+        {
+            auto lazy = importFile(bytes, true, bytesOutliveFile);
+            REQUIRE(eager->artboardCount() == lazy->artboardCount());
+            REQUIRE(eager->assets().size() == lazy->assets().size());
+            for (size_t i = 0; i < eager->artboardCount(); i++)
+            {
+                REQUIRE(eager->artboardNameAt(i) == lazy->artboardNameAt(i));
+                requireSameArtboard(eager->artboard(i), lazy->artboard(i));
+            }
+        }
+    }
+}
+
+TEST_CASE("lazily imported artboards are read when they're asked for", "[file]")
+{
+    auto bytes = readBytes("../../test/assets/two_artboards.riv");
+    auto file = importFile(bytes, true);
+    REQUIRE(file->artboardCount() == 2);
+    REQUIRE(!file->isArtboardLoaded(0));
+    REQUIRE(!file->isArtboardLoaded(1));
+
+    // Names are known upfront.
+    auto name = file->artboardNameAt(1);
+    REQUIRE(!name.empty());
+    REQUIRE(!file->isArtboardLoaded(1));
+
+    REQUIRE(file->artboard(name) != nullptr);
+    REQUIRE(!file->isArtboardLoaded(0));
+    REQUIRE(file->isArtboardLoaded(1));
+
+    auto instance = file->artboardDefault();
+    REQUIRE(instance != nullptr);
+    REQUIRE(file->isArtboardLoaded(0));
+
+    // Reading again returns the same artboard.
+    REQUIRE(file->artboard(1) == file->artboard(name));
+    REQUIRE(file->artboard(2) == nullptr);
+
+    // Eager imports have every artboard read.
+    auto eager = importFile(bytes, false);
+    REQUIRE(eager->isArtboardLoaded(0));
+    REQUIRE(eager->isArtboardLoaded(1));
+}
+
+TEST_CASE("benchmark lazy import", "[.benchmark]")
+{
+    for (auto path : {"two_artboards.riv", "death_knight.riv", "walle.riv"})
+    {
+        auto bytes = readBytes((std::string("../../test/assets/") + path).c_str());
+        BENCHMARK(std::string("eager import ") + path) { return importFile(bytes, false); };
+        BENCHMARK(std::string("lazy import ") + path) { return importFile(bytes, true); };
+        BENCHMARK(std::string("lazy import first artboard ") + path)
+        {
+            auto file = importFile(bytes, true);
+            return file->artboardDefault();
+        };
+    }
+}
@@ -1,9 +1,18 @@
 #include <rive/animation/loop.hpp>
 #include <rive/animation/linear_animation.hpp>
 #include <rive/animation/linear_animation_instance.hpp>
+#include <rive/animation/keyed_property.hpp>
+#include <rive/animation/keyframe_color.hpp>
+#include <rive/animation/keyframe_double.hpp>
+#include <rive/animation/pose_buffer.hpp>
+#include <rive/node.hpp>
+#include <rive/transform_component.hpp>
+#include <rive/generated/core_registry.hpp>
 #include "utils/no_op_factory.hpp"
+#include "rive_file_reader.hpp"
 #include <catch.hpp>
 #include <cstdio>
+#include <string>
 
 TEST_CASE("LinearAnimationInstance oneShot", "[animation]")
 {
@@ -408,3 +417,280 @@ TEST_CASE("LinearAnimationInstance override loop", "[animation]")
     delete linearAnimationInstance;
     delete linearAnimation;
 }
+
+static void requireSameTransforms(rive::Artboard* a, rive::Artboard* b)
+{
+    const auto& objectsA = a->objects();
+    const auto& objectsB = b->objects();
+    REQUIRE(objectsA.size() == objectsB.size());
+    for (size_t i = 0; i < objectsA.size(); i++)
+    {
+        if (objectsA[i] == nullptr || !objectsA[i]->is<rive::TransformComponent>())
+        {
+            continue;
+        }
+        auto componentA = objectsA[i]->as<rive::TransformComponent>();
+        auto componentB = objectsB[i]->as<rive::TransformComponent>();
+        REQUIRE(componentA->worldTransform() == componentB->worldTransform());
+        REQUIRE(componentA->renderOpacity() == componentB->renderOpacity());
+    }
+}
+
+TEST_CASE("LinearAnimationInstance keyframe cursors match keyframe search", "[animation]")
+{
+    const char* assets[] = {
+        "../../test/assets/juice.riv",
+        "../../test/assets/walle.riv",
+    };
+    for (auto asset : assets)
+    {
+        auto file = ReadRiveFile(asset);
+        auto cursorArtboard = file->artboardDefault();
+        auto searchArtboard = file->artboardDefault();
+        for (size_t i = 0; i < cursorArtboard->animationCount(); i++)
+        {
+            auto animationInstance = cursorArtboard->animationAt(i);
+            auto animation = animationInstance->animation();
+            float step = 1.0f / 60.0f;
+            for (int frame = 0; frame < 600; frame++)
+            {
+                if (frame == 300)
+                {
+                    // Seek back, the cursors have to recover.
+                    animationInstance->time(animation->startSeconds());
+                }
+                else if (frame == 400)
+                {
+                    // Play backwards.
+                    step = -step;
+                }
+                animationInstance->advance(step);
+                animationInstance->apply();
+                animation->apply(searchArtboard.get(), animationInstance->time());
+                cursorArtboard->advance(0.0f);
+                searchArtboard->advance(0.0f);
+                if (frame % 7 == 0)
+                {
+                    requireSameTransforms(cursorArtboard.get(), searchArtboard.get());
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("applying a batch of instances matches applying them one by one", "[animation]")
+{
+    const char* assets[] = {
+        "../../test/assets/juice.riv",
+        "../../test/assets/walle.riv",
+    };
+    // More instances than are applied together.
+    const size_t crowdSize = 80;
+    for (auto asset : assets)
+    {
+        auto file = ReadRiveFile(asset);
+        auto animationCount = file->artboardDefault()->animationCount();
+        for (size_t a = 0; a < animationCount; a++)
+        {
+            std::vector<std::unique_ptr<rive::ArtboardInstance>> batchedArtboards, singleArtboards;
+            std::vector<std::unique_ptr<rive::LinearAnimationInstance>> batched, single;
+            std::vector<rive::PoseBuffer> batchedPoses(crowdSize), singlePoses(crowdSize);
+            for (size_t i = 0; i < crowdSize; i++)
+            {
+                batchedArtboards.push_back(file->artboardDefault());
+                singleArtboards.push_back(file->artboardDefault());
+                batched.push_back(batchedArtboards.back()->animationAt(a));
+                single.push_back(singleArtboards.back()->animationAt(a));
+                // A few phases shared by most of the crowd, and some stragglers.
+                float start = i % 7 == 6 ? i * 0.07f : (i % 4) * 0.25f;
+                batched.back()->advance(start);
+                single.back()->advance(start);
+            }
+            auto animation = batched.front()->animation();
+            std::vector<rive::AnimationSample> samples;
+            for (int frame = 0; frame < 40; frame++)
+            {
+                samples.clear();
+                for (size_t i = 0; i < crowdSize; i++)
+                {
+                    batched[i]->advance(1.0f / 30.0f);
+                    single[i]->advance(1.0f / 30.0f);
+                    float mix = i % 3 == 0 ? 0.5f : 1.0f;
+                    // Some accumulate into a pose, applied on top of another
+                    // animation's.
+                    bool usePose = i % 5 == 2;
+                    if (usePose)
+                    {
+                        auto other = a == 0 ? animationCount - 1 : 0;
+                        batchedArtboards[i]->animation(other)->apply(batchedArtboards[i].get(),
+                                                                     0.1f,
+                                                                     1.0f,
+                                                                     nullptr,
+                                                                     nullptr,
+                                                                     &batchedPoses[i]);
+                        singleArtboards[i]->animation(other)->apply(singleArtboards[i].get(),
+                                                                    0.1f,
+                                                                    1.0f,
+                                                                    nullptr,
+                                                                    nullptr,
+                                                                    &singlePoses[i]);
+                    }
+                    samples.push_back(batched[i]->sample(mix, usePose ? &batchedPoses[i] : nullptr));
+                    if (i == 1)
+                    {
+                        // Neither cursors nor resolved objects.
+                        samples.back().keyFrameCursors = nullptr;
+                        samples.back().keyedObjects = nullptr;
+                    }
+                    single[i]->apply(mix, usePose ? &singlePoses[i] : nullptr);
+                }
+                animation->applyBatch(samples);
+                for (size_t i = 0; i < crowdSize; i++)
+                {
+                    batchedPoses[i].write();
+                    singlePoses[i].write();
+                    batchedArtboards[i]->advance(0.0f);
+                    singleArtboards[i]->advance(0.0f);
+                    requireSameTransforms(batchedArtboards[i].get(), singleArtboards[i].get());
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("CoreRegistry typed accessors match the property switch", "[animation]")
+{
+    rive::Node node;
+    auto setX = rive::CoreRegistry::doubleSetter(rive::NodeBase::xPropertyKey);
+    auto getX = rive::CoreRegistry::doubleGetter(rive::NodeBase::xPropertyKey);
+    REQUIRE(setX != nullptr);
+    REQUIRE(getX != nullptr);
+    setX(&node, 12.0f);
+    REQUIRE(node.x() == 12.0f);
+    REQUIRE(getX(&node) == rive::CoreRegistry::getDouble(&node, rive::NodeBase::xPropertyKey));
+
+    rive::SolidColor solidColor;
+    auto setColor = rive::CoreRegistry::colorSetter(rive::SolidColorBase::colorValuePropertyKey);
+    REQUIRE(setColor != nullptr);
+    setColor(&solidColor, 0xFF00FF00);
+    REQUIRE(solidColor.colorValue() == (int)0xFF00FF00);
+
+    // Keys of another type (or no property at all) have no accessor.
+    REQUIRE(rive::CoreRegistry::doubleSetter(rive::SolidColorBase::colorValuePropertyKey) ==
+            nullptr);
+    REQUIRE(rive::CoreRegistry::colorGetter(rive::NodeBase::xPropertyKey) == nullptr);
+    REQUIRE(rive::CoreRegistry::boolSetter(-1) == nullptr);
+}
+
+TEST_CASE("keyed properties mixing keyframe types are left unbound", "[animation]")
+{
+    rive::NoOpFactory emptyFactory;
+    rive::Artboard artboard(&emptyFactory);
+    rive::Node node;
+
+    auto doubleKeyFrame = [](float value) {
+        auto keyFrame = new rive::KeyFrameDouble();
+        keyFrame->value(value);
+        return std::unique_ptr<rive::KeyFrame>(keyFrame);
+    };
+
+    rive::KeyedProperty doubles;
+    doubles.propertyKey(rive::NodeBase::xPropertyKey);
+    doubles.addKeyFrame(doubleKeyFrame(10.0f));
+    doubles.addKeyFrame(doubleKeyFrame(10.0f));
+    REQUIRE(doubles.onAddedDirty(&artboard) == rive::StatusCode::Ok);
+    doubles.apply(&node, 0.0f, 1.0f);
+    REQUIRE(node.x() == 10.0f);
+
+    // Not fatal to the file, the property just isn't applied.
+    rive::KeyedProperty mixed;
+    mixed.propertyKey(rive::NodeBase::xPropertyKey);
+    mixed.addKeyFrame(doubleKeyFrame(20.0f));
+    mixed.addKeyFrame(std::unique_ptr<rive::KeyFrame>(new rive::KeyFrameColor()));
+    REQUIRE(mixed.onAddedDirty(&artboard) == rive::StatusCode::Ok);
+    mixed.apply(&node, 0.0f, 1.0f);
+    REQUIRE(node.x() == 10.0f);
+}
+
+TEST_CASE("benchmark keyframe apply", "[.benchmark]")
+{
+    auto file = ReadRiveFile("../../test/assets/juice.riv");
+    auto artboard = file->artboardDefault();
+    // Pick the animation keying the most properties.
+    size_t index = 0;
+    for (size_t i = 1; i < artboard->animationCount(); i++)
+    {
+        if (artboard->animation(i)->keyedPropertyCount() >
+            artboard->animation(index)->keyedPropertyCount())
+        {
+            index = i;
+        }
+    }
+    auto animationInstance = artboard->animationAt(index);
+    auto animation = animationInstance->animation();
+
+    BENCHMARK("apply with cursors")
+    {
+        animationInstance->advance(1.0f / 60.0f);
+        animationInstance->apply();
+        return animationInstance->time();
+    };
+    BENCHMARK("apply with search")
+    {
+        animationInstance->advance(1.0f / 60.0f);
+        animation->apply(artboard.get(), animationInstance->time());
+        return animationInstance->time();
+    };
+}
+
+TEST_CASE("benchmark batched apply", "[.benchmark]")
+{
+    auto file = ReadRiveFile("../../test/assets/juice.riv");
+    // Pick the animation keying the most properties.
+    auto artboard = file->artboardDefault();
+    size_t index = 0;
+    for (size_t i = 1; i < artboard->animationCount(); i++)
+    {
+        if (artboard->animation(i)->keyedPropertyCount() >
+            artboard->animation(index)->keyedPropertyCount())
+        {
+            index = i;
+        }
+    }
+    // A crowd all at different times, and one in 8 phases.
+    for (int phases : {256, 8})
+    {
+        std::vector<std::unique_ptr<rive::ArtboardInstance>> artboards;
+        std::vector<std::unique_ptr<rive::LinearAnimationInstance>> crowd;
+        for (int i = 0; i < 256; i++)
+        {
+            artboards.push_back(file->artboardDefault());
+            crowd.push_back(artboards.back()->animationAt(index));
+            crowd.back()->advance((i % phases) * 0.01f);
+        }
+        auto animation = crowd.front()->animation();
+        std::vector<rive::AnimationSample> samples;
+        auto suffix = std::string(", ") + std::to_string(phases) + " phases";
+
+        BENCHMARK("apply one by one" + suffix)
+        {
+            for (auto& instance : crowd)
+            {
+                instance->advance(1.0f / 60.0f);
+                instance->apply();
+            }
+            return crowd.front()->time();
+        };
+        BENCHMARK("apply batched" + suffix)
+        {
+            samples.clear();
+            for (auto& instance : crowd)
+            {
+                instance->advance(1.0f / 60.0f);
+                samples.push_back(instance->sample());
+            }
+            animation->applyBatch(samples);
+            return crowd.front()->time();
+        };
+    }
+}
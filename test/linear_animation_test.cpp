@@ -1,6 +1,10 @@
 #include <rive/artboard.hpp>
 #include <rive/animation/linear_animation.hpp>
+#include <rive/animation/keyed_object.hpp>
+#include <rive/animation/keyed_property.hpp>
+#include <rive/generated/core_registry.hpp>
 #include "utils/no_op_factory.hpp"
+#include "rive_file_reader.hpp"
 #include <catch.hpp>
 #include <cstdio>
 
@@ -51,3 +55,74 @@ TEST_CASE("LinearAnimation with negative speed have reversed start and end secon
 
     delete linearAnimation;
 }
+
+TEST_CASE("double and color keyframes are compacted", "[animation]")
+{
+    auto file = ReadRiveFile("../../test/assets/juice.riv");
+    auto artboard = file->artboard();
+    size_t compacted = 0;
+    for (size_t i = 0; i < artboard->animationCount(); i++)
+    {
+        auto animation = artboard->animation(i);
+        for (size_t j = 0; j < animation->numKeyedObjects(); j++)
+        {
+            auto object = animation->getObject(j);
+            for (size_t k = 0; k < object->keyedPropertyCount(); k++)
+            {
+                auto property = object->getProperty(k);
+                REQUIRE(property->keyFrameCount() > 0);
+                int fieldId = rive::CoreRegistry::propertyFieldId(property->propertyKey());
+                if (fieldId == rive::CoreDoubleType::id || fieldId == rive::CoreColorType::id)
+                {
+                    REQUIRE(property->isCompacted());
+                    compacted++;
+                }
+            }
+        }
+    }
+    REQUIRE(compacted > 0);
+}
+
+TEST_CASE("batched keyframe interpolation matches applying each property", "[animation]")
+{
+    auto file = ReadRiveFile("../../test/assets/juice.riv");
+    auto batchedArtboard = file->artboardDefault();
+    auto singleArtboard = file->artboardDefault();
+    for (size_t i = 0; i < batchedArtboard->animationCount(); i++)
+    {
+        auto animation = batchedArtboard->animation(i);
+        for (float mix : {1.0f, 0.6f})
+        {
+            for (float time = 0.0f; time < animation->durationSeconds(); time += 0.1f)
+            {
+                animation->apply(batchedArtboard.get(), time, mix);
+                for (size_t j = 0; j < animation->numKeyedObjects(); j++)
+                {
+                    animation->getObject(j)->apply(singleArtboard.get(), time, mix);
+                }
+                // Objects share a batch, the order they're dirtied in doesn't
+                // change what they update to.
+                batchedArtboard->advance(0.0f);
+                singleArtboard->advance(0.0f);
+                const auto& batchedObjects = batchedArtboard->objects();
+                const auto& singleObjects = singleArtboard->objects();
+                for (size_t j = 0; j < batchedObjects.size(); j++)
+                {
+                    auto node = batchedObjects[j];
+                    if (node == nullptr || !node->is<rive::TransformComponent>())
+                    {
+                        continue;
+                    }
+                    auto a = node->as<rive::TransformComponent>();
+                    auto b = singleObjects[j]->as<rive::TransformComponent>();
+                    REQUIRE(a->rotation() == b->rotation());
+                    REQUIRE(a->scaleX() == b->scaleX());
+                    REQUIRE(a->scaleY() == b->scaleY());
+                    REQUIRE(a->opacity() == b->opacity());
+                    REQUIRE(a->worldTransform() == b->worldTransform());
+                    REQUIRE(a->renderOpacity() == b->renderOpacity());
+                }
+            }
+        }
+    }
+}
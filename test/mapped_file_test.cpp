@@ -0,0 +1,53 @@
+#include <rive/file.hpp>
+#include <rive/mapped_file.hpp>
+#include <rive/shapes/image.hpp>
+#include <rive/assets/image_asset.hpp>
+#include <utils/no_op_factory.hpp>
+#include "rive_file_reader.hpp"
+#include <catch.hpp>
+#include <cstdio>
+
+// Records the bytes images are decoded from.
+class DecodeRecordingFactory : public rive::NoOpFactory
+{
+public:
+    std::vector<rive::Span<const uint8_t>> decoded;
+
+    std::unique_ptr<rive::RenderImage> decodeImage(rive::Span<const uint8_t> bytes) override
+    {
+        decoded.push_back(bytes);
+        return nullptr;
+    }
+};
+
+TEST_CASE("mapped files can be imported", "[file]")
+{
+    auto mapped = rive::MappedFile::open("../../test/assets/walle.riv");
+    REQUIRE(mapped != nullptr);
+    auto bytes = mapped->bytes();
+    REQUIRE(bytes.size() > 0);
+
+    DecodeRecordingFactory factory;
+    rive::ImportOptions options;
+    options.lazyArtboards = true;
+    options.bytesOutliveFile = true;
+    rive::ImportResult result;
+    auto file = rive::File::import(bytes, &factory, &result, nullptr, options);
+    REQUIRE(result == rive::ImportResult::success);
+
+    // Images are decoded from the imported bytes rather than a copy of them.
+    REQUIRE(factory.decoded.size() == 2);
+    for (auto decoded : factory.decoded)
+    {
+        REQUIRE(decoded.data() >= bytes.data());
+        REQUIRE(decoded.end() <= bytes.end());
+    }
+
+    auto node = file->artboard()->find("walle");
+    REQUIRE(node != nullptr);
+    REQUIRE(node->is<rive::Image>());
+    REQUIRE(node->as<rive::Image>()->imageAsset()->decodedByteSize == 218873);
+    REQUIRE(file->artboardDefault() != nullptr);
+
+    REQUIRE(rive::MappedFile::open("../../test/assets/not_a_file.riv") == nullptr);
+}
@@ -0,0 +1,188 @@
+#include <rive/file.hpp>
+#include <rive/node.hpp>
+#include <rive/shapes/shape.hpp>
+#include <rive/animation/state_machine_bool.hpp>
+#include <rive/animation/state_machine_input.hpp>
+#include <rive/animation/state_machine_input_instance.hpp>
+#include <rive/animation/state_machine_instance.hpp>
+#include <rive/animation/state_machine_number.hpp>
+#include <rive/animation/state_machine_trigger.hpp>
+#include "catch.hpp"
+#include "rive_file_reader.hpp"
+#include <cstdio>
+
+template <typename T> static T* linearFind(rive::Artboard* artboard, const std::string& name)
+{
+    for (auto object : artboard->objects())
+    {
+        if (object != nullptr && object->is<T>() && object->as<T>()->name() == name)
+        {
+            return static_cast<T*>(object);
+        }
+    }
+    return nullptr;
+}
+
+template <typename T> static std::vector<T*> linearFind(rive::Artboard* artboard)
+{
+    std::vector<T*> results;
+    for (auto object : artboard->objects())
+    {
+        if (object != nullptr && object->is<T>())
+        {
+            results.push_back(static_cast<T*>(object));
+        }
+    }
+    return results;
+}
+
+static void requireSameLookups(rive::Artboard* artboard)
+{
+    for (auto object : artboard->objects())
+    {
+        if (object == nullptr || !object->is<rive::Component>())
+        {
+            continue;
+        }
+        const std::string& name = object->as<rive::Component>()->name();
+        REQUIRE(artboard->find(name) == linearFind<rive::Component>(artboard, name));
+        REQUIRE(artboard->find<rive::Node>(name) == linearFind<rive::Node>(artboard, name));
+        REQUIRE(artboard->find<rive::Shape>(name) == linearFind<rive::Shape>(artboard, name));
+    }
+    REQUIRE(artboard->find("not a name") == nullptr);
+
+    REQUIRE(artboard->find<rive::Component>() == linearFind<rive::Component>(artboard));
+    REQUIRE(artboard->find<rive::Node>() == linearFind<rive::Node>(artboard));
+    REQUIRE(artboard->find<rive::Shape>() == linearFind<rive::Shape>(artboard));
+    REQUIRE(artboard->find<rive::Artboard>().size() == 1);
+
+    for (size_t i = 0; i < artboard->animationCount(); i++)
+    {
+        auto animation = artboard->animation(i);
+        auto found = artboard->animation(animation->name());
+        REQUIRE(found != nullptr);
+        REQUIRE(found->name() == animation->name());
+        // The first animation with that name.
+        for (size_t j = 0; artboard->animation(j) != found; j++)
+        {
+            REQUIRE(artboard->animation(j)->name() != animation->name());
+        }
+    }
+    for (size_t i = 0; i < artboard->stateMachineCount(); i++)
+    {
+        auto machine = artboard->stateMachine(i);
+        REQUIRE(artboard->stateMachine(machine->name())->name() == machine->name());
+    }
+    REQUIRE(artboard->animation("not a name") == nullptr);
+    REQUIRE(artboard->stateMachine("not a name") == nullptr);
+}
+
+TEST_CASE("lookups by name and type match searching the artboard", "[file]")
+{
+    const char* paths[] = {
+        "../../test/assets/walle.riv",
+        "../../test/assets/juice.riv",
+        "../../test/assets/two_artboards.riv",
+        "../../test/assets/multiple_state_machines.riv",
+    };
+    for (auto path : paths)
+    {
+        auto file = ReadRiveFile(path);
+        for (size_t i = 0; i < file->artboardCount(); i++)
+        {
+            auto artboard = file->artboard(i);
+            REQUIRE(file->artboard(artboard->name())->name() == artboard->name());
+            requireSameLookups(artboard);
+
+            // Instances share their source's indexes but find their own
+            // objects.
+            auto instance = artboard->instance();
+            requireSameLookups(instance.get());
+            for (auto object : artboard->objects())
+            {
+                if (object != nullptr && object->is<rive::Node>())
+                {
+                    auto name = object->as<rive::Node>()->name();
+                    REQUIRE(instance->find<rive::Node>(name) != object);
+                    REQUIRE(instance->find<rive::Node>(name) ==
+                            linearFind<rive::Node>(instance.get(), name));
+                }
+            }
+        }
+        REQUIRE(file->artboard("not a name") == nullptr);
+        REQUIRE(file->artboardNamed("not a name") == nullptr);
+    }
+}
+
+TEST_CASE("inputs are looked up by name and type", "[file]")
+{
+    auto file = ReadRiveFile("../../test/assets/multiple_state_machines.riv");
+    auto artboard = file->artboard()->instance();
+    for (size_t i = 0; i < artboard->stateMachineCount(); i++)
+    {
+        auto machine = artboard->stateMachineAt(i);
+        for (size_t j = 0; j < machine->inputCount(); j++)
+        {
+            auto input = machine->input(j);
+            const std::string& name = input->name();
+            REQUIRE(machine->stateMachine()->input(name)->name() == name);
+            if (input->input()->is<rive::StateMachineBool>())
+            {
+                REQUIRE(machine->getBool(name) == input);
+                REQUIRE(machine->getNumber(name) == nullptr);
+            }
+            else if (input->input()->is<rive::StateMachineNumber>())
+            {
+                REQUIRE(machine->getNumber(name) == input);
+                REQUIRE(machine->getTrigger(name) == nullptr);
+            }
+            else if (input->input()->is<rive::StateMachineTrigger>())
+            {
+                REQUIRE(machine->getTrigger(name) == input);
+                REQUIRE(machine->getBool(name) == nullptr);
+            }
+        }
+        REQUIRE(machine->getBool("not a name") == nullptr);
+    }
+}
+
+TEST_CASE("name lookups take std::string, C strings and StringViews", "[file]")
+{
+    auto file = ReadRiveFile("../../test/assets/light_switch.riv");
+    auto artboard = file->artboard(0);
+    const std::string name = artboard->name();
+    const char* cName = name.c_str();
+    REQUIRE(file->artboard(name) == artboard);
+    REQUIRE(file->artboard(cName) == artboard);
+    REQUIRE(file->artboard(rive::StringView(name)) == artboard);
+    REQUIRE(file->artboardNamed(cName) != nullptr);
+
+    // The first state machine with inputs.
+    rive::StateMachine* machine = nullptr;
+    for (size_t i = 0; machine == nullptr && i < artboard->stateMachineCount(); i++)
+    {
+        machine = artboard->stateMachine(i);
+        machine = machine->inputCount() != 0 ? machine : nullptr;
+    }
+    REQUIRE(machine != nullptr);
+    const std::string machineName = machine->name();
+    REQUIRE(artboard->stateMachine(machineName) == machine);
+    REQUIRE(artboard->stateMachine(machineName.c_str()) == machine);
+    const std::string inputName = machine->input(0)->name();
+    REQUIRE(machine->input(inputName) == machine->input(0));
+    REQUIRE(machine->input(inputName.c_str()) == machine->input(0));
+
+    // Pointers to the std::string overloads still resolve.
+    rive::StateMachine* (rive::Artboard::*byString)(const std::string&) const =
+        &rive::Artboard::stateMachine;
+    REQUIRE((artboard->*byString)(machineName) == machine);
+
+    auto instance = artboard->instance();
+    auto scene = instance->stateMachineNamed(machineName);
+    rive::Scene* base = scene.get();
+    REQUIRE(base->getBool(inputName) == scene->getBool(rive::StringView(inputName)));
+    REQUIRE(base->getNumber(inputName.c_str()) == scene->getNumber(inputName));
+    REQUIRE(base->getTrigger(inputName) == scene->getTrigger(inputName.c_str()));
+    REQUIRE((base->getBool(inputName) != nullptr || base->getNumber(inputName) != nullptr ||
+             base->getTrigger(inputName) != nullptr));
+}
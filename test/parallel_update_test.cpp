@@ -0,0 +1,215 @@
+#include <rive/artboard.hpp>
+#include <rive/file.hpp>
+#include <rive/node.hpp>
+#include <rive/worker_pool.hpp>
+#include <rive/shapes/ellipse.hpp>
+#include <rive/shapes/rectangle.hpp>
+#include <rive/shapes/shape.hpp>
+#include <rive/animation/linear_animation_instance.hpp>
+#include <utils/no_op_factory.hpp>
+#include "catch.hpp"
+#include "rive_file_reader.hpp"
+
+// Run these under ThreadSanitizer with dev/test.sh thread.
+
+// An artboard of groupCount nodes, each holding a shape made of a rectangle
+// and an ellipse: wide dependency levels of independent components.
+static std::unique_ptr<rive::Artboard> makeWideArtboard(rive::Factory* factory, int groupCount)
+{
+    std::unique_ptr<rive::Artboard> artboard(new rive::Artboard(factory));
+    artboard->addObject(artboard.get());
+    for (int i = 0; i < groupCount; i++)
+    {
+        uint32_t nodeId = (uint32_t)artboard->objects().size();
+        auto node = new rive::Node();
+        node->x((float)(i % 64) * 10.0f);
+        node->y((float)(i / 64) * 10.0f);
+        auto shape = new rive::Shape();
+        shape->parentId(nodeId);
+        auto rectangle = new rive::Rectangle();
+        rectangle->parentId(nodeId + 1);
+        rectangle->width(8.0f);
+        rectangle->height(8.0f);
+        auto ellipse = new rive::Ellipse();
+        ellipse->parentId(nodeId + 1);
+        ellipse->width(4.0f);
+        ellipse->height(4.0f);
+        artboard->addObject(node);
+        artboard->addObject(shape);
+        artboard->addObject(rectangle);
+        artboard->addObject(ellipse);
+    }
+    return artboard;
+}
+
+// Changes every group's transform and paths, as an animation would.
+static void animateWideArtboard(rive::Artboard* artboard, int frame)
+{
+    for (auto object : artboard->objects())
+    {
+        if (object->is<rive::Node>() && !object->is<rive::Shape>() &&
+            !object->is<rive::Rectangle>() && !object->is<rive::Ellipse>())
+        {
+            object->as<rive::Node>()->rotation(frame * 0.1f);
+        }
+        else if (object->is<rive::Rectangle>())
+        {
+            object->as<rive::Rectangle>()->width(8.0f + frame);
+        }
+    }
+}
+
+static void requireSameTransforms(rive::Artboard* a, rive::Artboard* b)
+{
+    auto& objects = a->objects();
+    REQUIRE(objects.size() == b->objects().size());
+    for (size_t i = 0; i < objects.size(); i++)
+    {
+        if (objects[i] != nullptr && objects[i]->is<rive::TransformComponent>())
+        {
+            auto ta = objects[i]->as<rive::TransformComponent>();
+            auto tb = b->objects()[i]->as<rive::TransformComponent>();
+            REQUIRE(ta->worldTransform() == tb->worldTransform());
+            REQUIRE(ta->renderOpacity() == tb->renderOpacity());
+        }
+    }
+}
+
+TEST_CASE("parallel component updates match serial ones", "[parallel]")
+{
+    rive::WorkerPool pool(3);
+
+    rive::NoOpFactory factory;
+    auto parallel = makeWideArtboard(&factory, 500);
+    auto serial = makeWideArtboard(&factory, 500);
+    REQUIRE(parallel->initialize() == rive::StatusCode::Ok);
+    REQUIRE(serial->initialize() == rive::StatusCode::Ok);
+    parallel->updateInParallel(&pool, 4);
+    for (int frame = 0; frame < 10; frame++)
+    {
+        animateWideArtboard(parallel.get(), frame);
+        animateWideArtboard(serial.get(), frame);
+        REQUIRE(parallel->advance(0.0f) == serial->advance(0.0f));
+        requireSameTransforms(parallel.get(), serial.get());
+    }
+    REQUIRE(!parallel->advance(0.0f));
+
+    const char* assets[] = {
+        "../../test/assets/bullet_man.riv",
+        "../../test/assets/death_knight.riv",
+        "../../test/assets/juice.riv",
+        "../../test/assets/solo_test.riv",
+        "../../test/assets/nested_solo.riv",
+        "../../test/assets/zombie_skins.riv",
+        "../../test/assets/complex_ik_dependency.riv",
+    };
+    for (auto asset : assets)
+    {
+        auto file = ReadRiveFile(asset);
+        auto a = file->artboardDefault();
+        auto b = file->artboardDefault();
+        a->updateInParallel(&pool, 4);
+        auto animationA = a->animationAt(0);
+        auto animationB = b->animationAt(0);
+        for (int frame = 0; frame < 30; frame++)
+        {
+            if (animationA != nullptr)
+            {
+                animationA->advanceAndApply(1.0f / 30.0f);
+                animationB->advanceAndApply(1.0f / 30.0f);
+            }
+            else
+            {
+                a->advance(0.0f);
+                b->advance(0.0f);
+            }
+            requireSameTransforms(a.get(), b.get());
+        }
+    }
+}
+
+// A node that, the first time it updates, dirties another node of its level.
+class DirtyingNode : public rive::Node
+{
+public:
+    DirtyingNode* other = nullptr;
+    bool dirtyOther = true;
+    int updates = 0;
+
+    void update(rive::ComponentDirt value) override
+    {
+        Node::update(value);
+        updates++;
+        if (dirtyOther)
+        {
+            dirtyOther = false;
+            other->addDirt(rive::ComponentDirt::RenderOpacity);
+        }
+    }
+};
+
+TEST_CASE("parallel component updates hold back dirt until the level's done", "[parallel]")
+{
+    rive::WorkerPool pool(3);
+    rive::NoOpFactory factory;
+    rive::Artboard artboard(&factory);
+    artboard.addObject(&artboard);
+    std::vector<DirtyingNode*> nodes;
+    for (int i = 0; i < 400; i++)
+    {
+        auto node = new DirtyingNode();
+        nodes.push_back(node);
+        artboard.addObject(node);
+    }
+    for (size_t i = 0; i < nodes.size(); i++)
+    {
+        nodes[i]->other = nodes[i ^ 1];
+    }
+    REQUIRE(artboard.initialize() == rive::StatusCode::Ok);
+    artboard.updateInParallel(&pool, 4);
+
+    // Every node updates on the level pass and gets dirtied by its partner
+    // meanwhile, so it updates again once the level's done.
+    REQUIRE(artboard.advance(0.0f));
+    for (auto node : nodes)
+    {
+        REQUIRE(node->updates == 2);
+    }
+    REQUIRE(!artboard.advance(0.0f));
+}
+
+TEST_CASE("parallel component updates can be turned off", "[parallel]")
+{
+    rive::WorkerPool pool(1);
+    rive::NoOpFactory factory;
+    auto artboard = makeWideArtboard(&factory, 100);
+    // Opting in before initializing groups the components once they're
+    // sorted.
+    artboard->updateInParallel(&pool, 2);
+    REQUIRE(artboard->initialize() == rive::StatusCode::Ok);
+    REQUIRE(artboard->advance(0.0f));
+    artboard->updateInParallel(nullptr, 0);
+    animateWideArtboard(artboard.get(), 1);
+    REQUIRE(artboard->advance(0.0f));
+    REQUIRE(!artboard->advance(0.0f));
+}
+
+TEST_CASE("benchmark parallel component updates", "[.benchmark]")
+{
+    rive::NoOpFactory factory;
+    rive::WorkerPool pool;
+    size_t maxThreads = pool.threadCount() + 1;
+    auto artboard = makeWideArtboard(&factory, 4000);
+    REQUIRE(artboard->initialize() == rive::StatusCode::Ok);
+    for (size_t threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        artboard->updateInParallel(&pool, threads);
+        int frame = 0;
+        BENCHMARK(std::to_string(threads) + " threads, " +
+                  std::to_string(artboard->objects().size()) + " objects")
+        {
+            animateWideArtboard(artboard.get(), frame++);
+            return artboard->advance(0.0f);
+        };
+    }
+}
@@ -0,0 +1,103 @@
+#include <rive/file.hpp>
+#include <rive/node.hpp>
+#include <rive/animation/linear_animation_instance.hpp>
+#include <rive/animation/pose_buffer.hpp>
+#include <rive/generated/core_registry.hpp>
+#include <rive/shapes/paint/solid_color.hpp>
+#include "catch.hpp"
+#include "rive_file_reader.hpp"
+#include <cstdio>
+
+static void requireSamePose(rive::ArtboardInstance* a, rive::ArtboardInstance* b)
+{
+    REQUIRE(a->objects().size() == b->objects().size());
+    for (size_t i = 0; i < a->objects().size(); i++)
+    {
+        auto objectA = a->objects()[i];
+        auto objectB = b->objects()[i];
+        if (objectA == nullptr || !objectA->is<rive::Node>())
+        {
+            continue;
+        }
+        auto nodeA = objectA->as<rive::Node>();
+        auto nodeB = objectB->as<rive::Node>();
+        REQUIRE(nodeA->x() == Approx(nodeB->x()).margin(0.0001f));
+        REQUIRE(nodeA->y() == Approx(nodeB->y()).margin(0.0001f));
+        REQUIRE(nodeA->rotation() == Approx(nodeB->rotation()).margin(0.0001f));
+        REQUIRE(nodeA->scaleX() == Approx(nodeB->scaleX()).margin(0.0001f));
+        REQUIRE(nodeA->scaleY() == Approx(nodeB->scaleY()).margin(0.0001f));
+    }
+}
+
+TEST_CASE("pose buffer matches applying animations one after the other", "[animation]")
+{
+    auto file = ReadRiveFile("../../test/assets/blend_test.riv");
+    auto artboard = file->artboard();
+
+    auto direct = artboard->instance();
+    auto pooled = artboard->instance();
+
+    float mixes[] = {1.0f, 0.3f, 0.6f};
+    const char* names[] = {"horizontal", "vertical", "rotate"};
+    for (float time : {0.0f, 0.25f, 0.5f})
+    {
+        rive::PoseBuffer pose;
+        for (int i = 0; i < 3; i++)
+        {
+            auto animation = artboard->animation(names[i]);
+            REQUIRE(animation != nullptr);
+            rive::LinearAnimationInstance directInstance(animation, direct.get());
+            rive::LinearAnimationInstance pooledInstance(animation, pooled.get());
+            directInstance.time(time);
+            pooledInstance.time(time);
+            directInstance.apply(mixes[i]);
+            pooledInstance.apply(mixes[i], &pose);
+        }
+        // Each animated property is accumulated once.
+        REQUIRE(pose.size() > 0);
+        size_t size = pose.size();
+        for (int i = 0; i < 3; i++)
+        {
+            rive::LinearAnimationInstance pooledInstance(artboard->animation(names[i]),
+                                                         pooled.get());
+            pooledInstance.time(time);
+            pooledInstance.apply(0.5f, &pose);
+            rive::LinearAnimationInstance directInstance(artboard->animation(names[i]),
+                                                         direct.get());
+            directInstance.time(time);
+            directInstance.apply(0.5f);
+        }
+        REQUIRE(pose.size() == size);
+
+        pose.write();
+        REQUIRE(pose.size() == 0);
+        requireSamePose(direct.get(), pooled.get());
+    }
+}
+
+TEST_CASE("pose buffer accumulates colors", "[animation]")
+{
+    auto key = rive::SolidColorBase::colorValuePropertyKey;
+    rive::KeyFramePropertyAccessor accessor;
+    accessor.setColor = rive::CoreRegistry::colorSetter(key);
+    accessor.getColor = rive::CoreRegistry::colorGetter(key);
+
+    rive::SolidColor direct;
+    rive::SolidColor pooled;
+    direct.colorValue(0xFF000000);
+    pooled.colorValue(0xFF000000);
+
+    rive::ColorInt colors[] = {0xFFFF0000, 0x8000FF00, 0xFF0000FF};
+    float mixes[] = {0.4f, 0.7f, 0.5f};
+    rive::PoseBuffer pose;
+    for (int i = 0; i < 3; i++)
+    {
+        direct.colorValue(rive::colorLerp(direct.colorValue(), colors[i], mixes[i]));
+        pose.accumulateColor(&pooled, accessor, colors[i], mixes[i]);
+    }
+    REQUIRE(pose.size() == 1);
+    // Nothing is written until the pose is.
+    REQUIRE(pooled.colorValue() == (int)0xFF000000);
+    pose.write();
+    REQUIRE(pooled.colorValue() == direct.colorValue());
+}
@@ -0,0 +1,114 @@
+#include <rive/file.hpp>
+#include <rive/profiler.hpp>
+#include <rive/animation/state_machine_instance.hpp>
+#include <utils/no_op_renderer.hpp>
+#include "rive_file_reader.hpp"
+#include <catch.hpp>
+#include <algorithm>
+
+// Loads, plays, draws and taps light_switch.riv.
+static void playLightSwitch()
+{
+    auto file = ReadRiveFile("../../test/assets/light_switch.riv");
+    auto artboard = file->artboardDefault();
+    auto stateMachine = artboard->stateMachineAt(0);
+    rive::NoOpRenderer renderer;
+    for (int frame = 0; frame < 3; frame++)
+    {
+        stateMachine->advanceAndApply(1.0f / 60.0f);
+        artboard->draw(&renderer);
+    }
+    stateMachine->pointerDown(rive::Vec2D(150.0f, 258.0f));
+    stateMachine->pointerUp(rive::Vec2D(150.0f, 258.0f));
+}
+
+TEST_CASE("profiler records nothing until enabled", "[profiler]")
+{
+    rive::Profiler::endFrame();
+    playLightSwitch();
+    auto frame = rive::Profiler::endFrame();
+    REQUIRE(frame.events.empty());
+    for (auto count : frame.componentUpdates)
+    {
+        REQUIRE(count == 0);
+    }
+}
+
+TEST_CASE("profiler times each phase of a frame", "[profiler]")
+{
+    rive::Profiler::enable(true);
+    playLightSwitch();
+    auto frame = rive::Profiler::endFrame();
+    rive::Profiler::enable(false);
+
+    REQUIRE(frame.end > frame.start);
+    REQUIRE(frame.count(rive::ProfilePhase::import) == 1);
+    REQUIRE(frame.count(rive::ProfilePhase::instance) == 1);
+    REQUIRE(frame.count(rive::ProfilePhase::advance) >= 3);
+    REQUIRE(frame.count(rive::ProfilePhase::keyFrameApply) >= 3);
+    REQUIRE(frame.count(rive::ProfilePhase::updateComponents) >= 1);
+    REQUIRE(frame.count(rive::ProfilePhase::pathRebuild) >= 1);
+    REQUIRE(frame.count(rive::ProfilePhase::hitTest) == 2);
+    REQUIRE(frame.count(rive::ProfilePhase::draw) == 3);
+    for (const auto& event : frame.events)
+    {
+        REQUIRE(event.start >= frame.start);
+        REQUIRE(event.start + event.duration <= frame.end);
+    }
+    REQUIRE(frame.duration(rive::ProfilePhase::advance) > 0);
+    REQUIRE(frame.duration(rive::ProfilePhase::advance) <= frame.end - frame.start);
+
+    int path = 4, worldTransform = 7;
+    REQUIRE(rive::Profiler::dirtName(path) == std::string("Path"));
+    REQUIRE(rive::Profiler::dirtName(worldTransform) == std::string("WorldTransform"));
+    REQUIRE(frame.componentUpdates[path] > 0);
+    REQUIRE(frame.componentUpdates[worldTransform] > 0);
+
+    // Frames start where the last one ended.
+    auto next = rive::Profiler::endFrame();
+    REQUIRE(next.start == frame.end);
+    REQUIRE(next.events.empty());
+}
+
+TEST_CASE("profiler counts nested scopes once in durations", "[profiler]")
+{
+    rive::ProfileFrame frame;
+    auto advance = rive::ProfilePhase::advance;
+    // A nested artboard's advance inside its parent's, and another thread's.
+    frame.events.push_back({advance, 0, 10, 20});
+    frame.events.push_back({advance, 0, 0, 100});
+    frame.events.push_back({advance, 1, 5, 15});
+    frame.events.push_back({advance, 0, 200, 50});
+    frame.events.push_back({rive::ProfilePhase::draw, 0, 300, 10});
+    REQUIRE(frame.count(advance) == 4);
+    REQUIRE(frame.duration(advance) == 100 + 15 + 50);
+    REQUIRE(frame.duration(rive::ProfilePhase::draw) == 10);
+    REQUIRE(frame.duration(rive::ProfilePhase::hitTest) == 0);
+}
+
+TEST_CASE("profiler exports Chrome trace events", "[profiler]")
+{
+    std::vector<rive::ProfileFrame> frames(2);
+    frames[0].start = 0;
+    frames[0].end = 16000000;
+    frames[0].events.push_back({rive::ProfilePhase::updateComponents, 0, 1500, 2250});
+    frames[0].events.push_back({rive::ProfilePhase::advance, 1, 1000, 5000});
+    frames[0].componentUpdates[4] = 12;
+    frames[1].start = 16000000;
+    frames[1].end = 32000000;
+
+    auto json = rive::Profiler::chromeTrace(frames);
+    REQUIRE(json.find("{\"traceEvents\":[") == 0);
+    REQUIRE(json.find("\"name\":\"updateComponents\",\"cat\":\"rive\",\"ph\":\"X\",\"pid\":0,"
+                      "\"tid\":0,\"ts\":1.500,\"dur\":2.250}") != std::string::npos);
+    REQUIRE(json.find("\"name\":\"advance\",\"cat\":\"rive\",\"ph\":\"X\",\"pid\":0,"
+                      "\"tid\":1,\"ts\":1.000,\"dur\":5.000}") != std::string::npos);
+    REQUIRE(json.find("\"ph\":\"C\",\"pid\":0,\"ts\":16000.000,\"args\":{\"Collapsed\":0,"
+                      "\"Dependents\":0,\"Components\":0,\"DrawOrder\":0,\"Path\":12,") !=
+            std::string::npos);
+    REQUIRE(json.find("\"name\":\"frame\",\"cat\":\"rive\",\"ph\":\"i\",\"s\":\"g\",\"pid\":0,"
+                      "\"tid\":0,\"ts\":32000.000}") != std::string::npos);
+    REQUIRE(json.substr(json.size() - 4) == "\n]}\n");
+    REQUIRE(std::count(json.begin(), json.end(), '{') == std::count(json.begin(), json.end(), '}'));
+    REQUIRE(std::count(json.begin(), json.end(), '[') == std::count(json.begin(), json.end(), ']'));
+}
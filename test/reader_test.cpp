@@ -18,6 +18,51 @@ TEST_CASE("uint leb decoder", "[reader]")
     REQUIRE(result == 624485);
 }
 
+TEST_CASE("uint leb fast paths match decoding byte by byte", "[reader]")
+{
+    uint64_t values[] = {0,
+                         1,
+                         0x7f,
+                         0x80,
+                         0x3fff,
+                         0x4000,
+                         0x1fffff,
+                         0x200000,
+                         0xffffffff,
+                         0x123456789abcdef,
+                         0xffffffffffffffff};
+    for (uint64_t value : values)
+    {
+        // Encoded at the end of buffers of every size, so each path is taken.
+        uint8_t buffer[16];
+        uint8_t encoded[10];
+        size_t length = 0;
+        uint64_t remaining = value;
+        do
+        {
+            uint8_t byte = remaining & 0x7f;
+            remaining >>= 7;
+            encoded[length++] = remaining != 0 ? (byte | 0x80) : byte;
+        } while (remaining != 0);
+
+        for (size_t padding = 0; padding <= 16 - length; padding++)
+        {
+            uint8_t* start = buffer + 16 - length - padding;
+            memcpy(start, encoded, length);
+            memset(start + length, 0, padding);
+            uint64_t fast = 0;
+            uint64_t checked = 0;
+            REQUIRE(decode_uint_leb(start, buffer + 16, &fast) == length);
+            REQUIRE(decode_uint_leb_checked(start, buffer + 16, &checked) == length);
+            REQUIRE(fast == value);
+            REQUIRE(checked == value);
+
+            // Truncated encodings overflow.
+            REQUIRE(decode_uint_leb(start, start + length - 1, &fast) == 0);
+        }
+    }
+}
+
 TEST_CASE("string decoder", "[reader]")
 {
     char* str = strdup("New Artboard");
@@ -0,0 +1,163 @@
+#include <rive/file.hpp>
+#include <rive/scene.hpp>
+#include <rive/scene_scheduler.hpp>
+#include <rive/worker_pool.hpp>
+#include <rive/drawable.hpp>
+#include <rive/animation/state_machine_instance.hpp>
+#include <rive/animation/state_machine_input_instance.hpp>
+#include <rive/animation/state_machine.hpp>
+#include "rive_file_reader.hpp"
+#include <catch.hpp>
+#include <atomic>
+
+// Run these under ThreadSanitizer with dev/test.sh thread.
+
+namespace
+{
+struct SceneGroup
+{
+    std::vector<std::unique_ptr<rive::ArtboardInstance>> artboards;
+    std::vector<std::unique_ptr<rive::Scene>> scenes;
+    std::vector<rive::Scene*> pointers;
+
+    void add(const rive::File* file, size_t copies)
+    {
+        for (size_t i = 0; i < copies; i++)
+        {
+            for (size_t j = 0; j < file->artboardCount(); j++)
+            {
+                auto artboard = file->artboardAt(j);
+                auto scene = artboard->defaultScene();
+                if (scene == nullptr)
+                {
+                    continue;
+                }
+                pointers.push_back(scene.get());
+                scenes.push_back(std::move(scene));
+                artboards.push_back(std::move(artboard));
+            }
+        }
+    }
+};
+
+const char* kAssets[] = {
+    "../../test/assets/bullet_man.riv",
+    "../../test/assets/death_knight.riv",
+    "../../test/assets/juice.riv",
+    "../../test/assets/light_switch.riv",
+    "../../test/assets/multiple_state_machines.riv",
+    "../../test/assets/two_bone_ik.riv",
+};
+} // namespace
+
+TEST_CASE("scheduler advances scenes as advancing them one by one does", "[scheduler]")
+{
+    std::vector<std::unique_ptr<rive::File>> files;
+    SceneGroup scheduled, serial;
+    for (auto asset : kAssets)
+    {
+        files.push_back(ReadRiveFile(asset));
+        scheduled.add(files.back().get(), 4);
+        serial.add(files.back().get(), 4);
+    }
+    REQUIRE(scheduled.pointers.size() > 8);
+
+    rive::SceneScheduler scheduler(4);
+    REQUIRE(scheduler.threadCount() == 4);
+    for (int frame = 0; frame < 60; frame++)
+    {
+        auto keepGoing = scheduler.advance(scheduled.pointers, 1.0f / 60.0f);
+        std::vector<rive::Scene*> expected;
+        for (size_t i = 0; i < serial.pointers.size(); i++)
+        {
+            if (serial.pointers[i]->advanceAndApply(1.0f / 60.0f))
+            {
+                expected.push_back(scheduled.pointers[i]);
+            }
+        }
+        REQUIRE(keepGoing == expected);
+    }
+
+    for (size_t i = 0; i < scheduled.artboards.size(); i++)
+    {
+        auto& a = scheduled.artboards[i]->objects();
+        auto& b = serial.artboards[i]->objects();
+        for (size_t j = 0; j < a.size(); j++)
+        {
+            if (a[j] != nullptr && a[j]->is<rive::Drawable>())
+            {
+                REQUIRE(a[j]->as<rive::Drawable>()->worldTransform() ==
+                        b[j]->as<rive::Drawable>()->worldTransform());
+            }
+        }
+    }
+}
+
+TEST_CASE("scheduler handles any number of scenes", "[scheduler]")
+{
+    auto file = ReadRiveFile("../../test/assets/juice.riv");
+    SceneGroup group;
+    group.add(file.get(), 3);
+
+    rive::SceneScheduler single(1);
+    REQUIRE(single.advance(rive::Span<rive::Scene* const>(), 0.0f).empty());
+    REQUIRE(single.advance(group.pointers, 1.0f / 60.0f).size() == group.pointers.size());
+
+    // More threads than scenes.
+    rive::SceneScheduler many(8);
+    auto keepGoing = many.advance(group.pointers, 1.0f / 60.0f);
+    REQUIRE(keepGoing == group.pointers);
+}
+
+TEST_CASE("scenes can be made and looked up on several threads", "[scheduler]")
+{
+    RenderObjectLeakChecker checker;
+    auto file = ReadRiveFile("../../test/assets/light_switch.riv");
+    std::atomic<int> found{0};
+    {
+        rive::WorkerPool pool(4);
+        for (int i = 0; i < 32; i++)
+        {
+            pool.execute([&file, &found]() {
+                // Names and types are indexed the first time they're looked
+                // up, by whichever thread gets there first.
+                auto artboard = file->artboardNamed(file->artboardNameAt(0));
+                auto machine = artboard->stateMachineNamed(artboard->stateMachineNameAt(0));
+                if (machine == nullptr || artboard->find<rive::Drawable>().empty())
+                {
+                    return;
+                }
+                for (size_t i = 0; i < machine->inputCount(); i++)
+                {
+                    auto input = machine->input(i);
+                    if (machine->stateMachine()->input(input->name()) != input->input())
+                    {
+                        return;
+                    }
+                }
+                machine->advanceAndApply(0.0f);
+                found++;
+            });
+        }
+    }
+    REQUIRE(found == 32);
+}
+
+TEST_CASE("benchmark scheduler", "[.benchmark]")
+{
+    std::vector<std::unique_ptr<rive::File>> files;
+    SceneGroup group;
+    for (auto asset : kAssets)
+    {
+        files.push_back(ReadRiveFile(asset));
+        group.add(files.back().get(), 16);
+    }
+    for (size_t threads : {1, 2, 4})
+    {
+        rive::SceneScheduler scheduler(threads);
+        BENCHMARK(std::to_string(threads) + " threads")
+        {
+            return scheduler.advance(group.pointers, 1.0f / 60.0f).size();
+        };
+    }
+}
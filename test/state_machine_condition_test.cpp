@@ -0,0 +1,114 @@
+#include <rive/file.hpp>
+#include <rive/animation/layer_state.hpp>
+#include <rive/animation/state_machine.hpp>
+#include <rive/animation/state_machine_bool.hpp>
+#include <rive/animation/state_machine_layer.hpp>
+#include <rive/animation/state_machine_instance.hpp>
+#include <rive/animation/state_machine_input_instance.hpp>
+#include <rive/animation/state_transition.hpp>
+#include <rive/animation/transition_condition.hpp>
+#include "catch.hpp"
+#include "rive_file_reader.hpp"
+#include <cstdio>
+
+TEST_CASE("compiled transition conditions match evaluating them", "[statemachine]")
+{
+    auto file = ReadRiveFile("../../test/assets/rocket.riv");
+    auto artboard = file->artboard();
+    auto machine = artboard->stateMachine("Button");
+    REQUIRE(machine != nullptr);
+    auto abi = artboard->instance();
+    rive::StateMachineInstance smi(machine, abi.get());
+
+    int compared = 0;
+    for (bool value : {false, true})
+    {
+        for (size_t i = 0; i < smi.inputCount(); i++)
+        {
+            auto input = smi.input(i);
+            if (input->inputCoreType() == rive::StateMachineBool::typeKey)
+            {
+                static_cast<rive::SMIBool*>(input)->value(value);
+            }
+        }
+        for (size_t l = 0; l < machine->layerCount(); l++)
+        {
+            auto layer = machine->layer(l);
+            for (size_t s = 0; s < layer->stateCount(); s++)
+            {
+                auto state = layer->state(s);
+                for (size_t t = 0; t < state->transitionCount(); t++)
+                {
+                    auto transition = state->transition(t);
+                    for (size_t c = 0; c < transition->conditionCount(); c++)
+                    {
+                        auto condition = transition->condition(c);
+                        auto input = smi.input(condition->inputId());
+                        auto compiled = rive::CompiledTransitionCondition::compile(condition);
+                        REQUIRE(compiled.type != rive::CompiledTransitionCondition::Type::other);
+                        REQUIRE(compiled.evaluate(input) == condition->evaluate(input));
+                        compared++;
+                    }
+                }
+            }
+        }
+    }
+    REQUIRE(compared > 0);
+}
+
+TEST_CASE("transition conditions are only evaluated when their inputs change", "[statemachine]")
+{
+    auto file = ReadRiveFile("../../test/assets/light_switch.riv");
+    auto artboard = file->artboard();
+    auto abi = artboard->instance();
+    rive::StateMachineInstance smi(artboard->stateMachine(0), abi.get());
+    auto on = smi.getBool("On");
+    REQUIRE(on != nullptr);
+
+    // Entering the first state evaluates its transitions with triggers
+    // ignored, the next advance evaluates them fully.
+    smi.advance(0.0f);
+    smi.advance(0.0f);
+    size_t settled = smi.evaluatedConditionCount();
+    REQUIRE(settled > 0);
+    for (int i = 0; i < 100; i++)
+    {
+        smi.advance(1.0f / 60.0f);
+    }
+    // No input changed and none of the transitions wait for an exit time.
+    REQUIRE(smi.evaluatedConditionCount() == settled);
+
+    auto state = smi.stateChangedByIndex(0);
+    on->value(!on->value());
+    smi.advance(1.0f / 60.0f);
+    REQUIRE(smi.evaluatedConditionCount() > settled);
+    REQUIRE(smi.stateChangedCount() == 1);
+    REQUIRE(smi.stateChangedByIndex(0) != state);
+}
+
+TEST_CASE("benchmark transition condition evaluation", "[.benchmark]")
+{
+    for (auto name : {"multiple_state_machines.riv", "rocket.riv", "light_switch.riv"})
+    {
+        auto file = ReadRiveFile((std::string("../../test/assets/") + name).c_str());
+        auto artboard = file->artboard();
+        for (size_t m = 0; m < artboard->stateMachineCount(); m++)
+        {
+            auto machine = artboard->stateMachine(m);
+            auto abi = artboard->instance();
+            rive::StateMachineInstance smi(machine, abi.get());
+            for (int i = 0; i < 600; i++)
+            {
+                smi.advance(1.0f / 60.0f);
+            }
+            printf("%s/%s: %zu conditions evaluated over 600 advances\n",
+                   name,
+                   machine->name().c_str(),
+                   smi.evaluatedConditionCount());
+            BENCHMARK((std::string(name) + "/" + machine->name()).c_str())
+            {
+                return smi.advance(1.0f / 60.0f);
+            };
+        }
+    }
+}
@@ -14,6 +14,7 @@
 #include <rive/animation/blend_state_transition.hpp>
 #include <rive/animation/listener_input_change.hpp>
 #include <rive/node.hpp>
+#include <rive/shapes/shape.hpp>
 #include "catch.hpp"
 #include "rive_file_reader.hpp"
 #include <cstdio>
@@ -115,3 +116,62 @@ TEST_CASE("hit a toggle boolean listener", "[file]")
     // Got toggled back on after pressing
     REQUIRE(switchButton->value() == true);
 }
+
+TEST_CASE("listeners follow their shapes when they move", "[file]")
+{
+    auto file = ReadRiveFile("../../test/assets/light_switch.riv");
+
+    auto artboard = file->artboard()->instance();
+    auto stateMachine = artboard->stateMachineAt(0);
+    artboard->advance(0.0f);
+    stateMachine->advance(0.0f);
+
+    auto switchButton = stateMachine->getBool("On");
+    REQUIRE(switchButton->value() == true);
+
+    // The bounds of every shape contain what it can hit.
+    rive::IAABB area = {148, 256, 152, 260};
+    std::vector<rive::Shape*> hitShapes;
+    for (auto object : artboard->objects())
+    {
+        if (object != nullptr && object->is<rive::Shape>())
+        {
+            auto shape = object->as<rive::Shape>();
+            if (shape->hitTest(area))
+            {
+                auto bounds = shape->computeWorldBounds();
+                REQUIRE(bounds.minX <= area.right);
+                REQUIRE(bounds.maxX >= area.left);
+                REQUIRE(bounds.minY <= area.bottom);
+                REQUIRE(bounds.maxY >= area.top);
+                hitShapes.push_back(shape);
+            }
+        }
+    }
+    REQUIRE(!hitShapes.empty());
+
+    stateMachine->pointerDown(rive::Vec2D(150.0f, 258.0f));
+    stateMachine->pointerUp(rive::Vec2D(150.0f, 258.0f));
+    REQUIRE(switchButton->value() == false);
+
+    // Move everything 1000 units to the right.
+    for (auto object : artboard->objects())
+    {
+        if (object != nullptr && object->is<rive::Node>() &&
+            object->as<rive::Node>()->parent() == artboard.get())
+        {
+            object->as<rive::Node>()->x(object->as<rive::Node>()->x() + 1000.0f);
+        }
+    }
+    auto version = hitShapes[0]->pathComposer()->version();
+    artboard->advance(0.0f);
+    REQUIRE(hitShapes[0]->pathComposer()->version() != version);
+
+    stateMachine->pointerDown(rive::Vec2D(150.0f, 258.0f));
+    stateMachine->pointerUp(rive::Vec2D(150.0f, 258.0f));
+    REQUIRE(switchButton->value() == false);
+
+    stateMachine->pointerDown(rive::Vec2D(1150.0f, 258.0f));
+    stateMachine->pointerUp(rive::Vec2D(1150.0f, 258.0f));
+    REQUIRE(switchButton->value() == true);
+}
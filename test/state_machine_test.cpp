@@ -1,3 +1,4 @@
+#include <rive/allocator.hpp>
 #include <rive/file.hpp>
 #include <rive/animation/state_machine_bool.hpp>
 #include <rive/animation/state_machine_layer.hpp>
@@ -13,6 +14,25 @@
 #include "catch.hpp"
 #include "rive_file_reader.hpp"
 #include <cstdio>
+#include <cstdlib>
+
+namespace
+{
+// Counts the allocations made for a scene's state.
+class CountingAllocator : public rive::Allocator
+{
+public:
+    int total = 0;
+
+    void* allocate(size_t size) override
+    {
+        total++;
+        return malloc(size);
+    }
+
+    void deallocate(void* ptr, size_t size) override { free(ptr); }
+};
+} // namespace
 
 TEST_CASE("file with state machine be read", "[file]")
 {
@@ -197,3 +217,32 @@ TEST_CASE("1D blend state keeps keepsGoing true even when animations themselves
 
     delete stateMachineInstance;
 }
+
+TEST_CASE("state machine transitions reuse their state instances", "[file]")
+{
+    auto file = ReadRiveFile("../../test/assets/light_switch.riv");
+
+    auto allocator = rive::make_rcp<CountingAllocator>();
+    auto artboard = file->artboard()->instance(allocator);
+    auto machine = artboard->stateMachineAt(0);
+    auto on = machine->getBool("On");
+    REQUIRE(on != nullptr);
+
+    // Visit every state once.
+    for (int i = 0; i < 4; i++)
+    {
+        on->value(!on->value());
+        machine->advanceAndApply(1.0f);
+    }
+    int warmedUp = allocator->total;
+
+    int changes = 0;
+    for (int i = 0; i < 20; i++)
+    {
+        on->value(!on->value());
+        machine->advanceAndApply(1.0f);
+        changes += (int)machine->stateChangedCount();
+    }
+    REQUIRE(changes > 0);
+    REQUIRE(allocator->total == warmedUp);
+}
@@ -0,0 +1,63 @@
+#include <rive/file.hpp>
+#include <rive/node.hpp>
+#include <rive/shapes/shape.hpp>
+#include <rive/animation/linear_animation_instance.hpp>
+#include "rive_file_reader.hpp"
+#include <catch.hpp>
+
+TEST_CASE("updateComponents only updates dirty components", "[file]")
+{
+    auto file = ReadRiveFile("../../test/assets/dependency_test.riv");
+
+    auto artboard = file->artboardDefault();
+    auto nodeB = artboard->find<rive::Node>("B");
+    auto nodeC = artboard->find<rive::Node>("C");
+    auto shape = artboard->find<rive::Shape>("Rectangle");
+    REQUIRE(nodeB != nullptr);
+    REQUIRE(nodeC != nullptr);
+    REQUIRE(shape != nullptr);
+
+    REQUIRE(artboard->advance(0.0f));
+    // Nothing changed, so nothing should be updated.
+    REQUIRE(!artboard->advance(0.0f));
+
+    auto shapeWorld = shape->worldTransform();
+    auto nodeCWorld = nodeC->worldTransform();
+    nodeC->x(nodeC->x() + 10.0f);
+    REQUIRE(artboard->advance(0.0f));
+    REQUIRE(nodeC->worldTransform()[4] == nodeCWorld[4] + 10.0f);
+    REQUIRE(shape->worldTransform() == shapeWorld);
+    REQUIRE(!artboard->advance(0.0f));
+
+    // Dirtying an upstream component must still propagate downstream, even
+    // though its dependents come later in the graph order.
+    nodeB->x(nodeB->x() + 5.0f);
+    REQUIRE(artboard->advance(0.0f));
+    REQUIRE(nodeC->worldTransform()[4] == nodeCWorld[4] + 15.0f);
+    REQUIRE(shape->worldTransform()[4] == shapeWorld[4] + 5.0f);
+}
+
+TEST_CASE("benchmark updateComponents", "[.benchmark]")
+{
+    const char* assets[] = {
+        "../../test/assets/juice.riv",
+        "../../test/assets/walle.riv",
+        "../../test/assets/bullet_man.riv",
+        "../../test/assets/death_knight.riv",
+    };
+    for (auto asset : assets)
+    {
+        auto file = ReadRiveFile(asset);
+        auto artboard = file->artboardDefault();
+        auto animation = artboard->animationAt(0);
+        REQUIRE(animation != nullptr);
+        artboard->advance(0.0f);
+
+        BENCHMARK(std::string("animated frame ") + asset)
+        {
+            animation->advanceAndApply(1.0f / 60.0f);
+            return artboard->objects().size();
+        };
+        BENCHMARK(std::string("idle frame ") + asset) { return artboard->advance(0.0f); };
+    }
+}
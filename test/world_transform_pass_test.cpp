@@ -0,0 +1,183 @@
+#include <rive/file.hpp>
+#include <rive/bones/bone.hpp>
+#include <rive/shapes/shape.hpp>
+#include <rive/transform_component.hpp>
+#include <rive/animation/linear_animation_instance.hpp>
+#include "rive_file_reader.hpp"
+#include <catch.hpp>
+
+TEST_CASE("world transform pass matches per component updates", "[file]")
+{
+    const char* assets[] = {
+        "../../test/assets/bullet_man.riv",
+        "../../test/assets/death_knight.riv",
+        "../../test/assets/juice.riv",
+        "../../test/assets/two_bone_ik.riv",
+        "../../test/assets/complex_ik_dependency.riv",
+        "../../test/assets/distance_constraint.riv",
+        "../../test/assets/rotation_constraint.riv",
+        "../../test/assets/scale_constraint.riv",
+        "../../test/assets/transform_constraint.riv",
+        "../../test/assets/translation_constraint.riv",
+    };
+    for (auto asset : assets)
+    {
+        auto file = ReadRiveFile(asset);
+        for (size_t i = 0; i < file->artboardCount(); i++)
+        {
+            auto batched = file->artboardAt(i);
+            auto unbatched = file->artboardAt(i);
+            unbatched->useWorldTransformPass(false);
+            REQUIRE(unbatched->worldTransformPass().count() == 0);
+
+            auto batchedAnimation = batched->animationAt(0);
+            auto unbatchedAnimation = unbatched->animationAt(0);
+            for (int frame = 0; frame < 30; frame++)
+            {
+                if (batchedAnimation != nullptr)
+                {
+                    batchedAnimation->advanceAndApply(1.0f / 30.0f);
+                    unbatchedAnimation->advanceAndApply(1.0f / 30.0f);
+                }
+                else
+                {
+                    batched->advance(0.0f);
+                    unbatched->advance(0.0f);
+                }
+                auto& objects = batched->objects();
+                for (size_t j = 0; j < objects.size(); j++)
+                {
+                    if (objects[j] == nullptr || !objects[j]->is<rive::TransformComponent>())
+                    {
+                        continue;
+                    }
+                    auto a = objects[j]->as<rive::TransformComponent>();
+                    auto b = unbatched->objects()[j]->as<rive::TransformComponent>();
+                    REQUIRE(aboutEqual(a->transform(), b->transform()));
+                    REQUIRE(aboutEqual(a->worldTransform(), b->worldTransform()));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("world transform pass leaves constrained transforms to their update", "[file]")
+{
+    auto file = ReadRiveFile("../../test/assets/two_bone_ik.riv");
+    auto artboard = file->artboardDefault();
+    auto& pass = artboard->worldTransformPass();
+    REQUIRE(pass.count() != 0);
+
+    size_t transformCount = 0;
+    size_t constrainedCount = 0;
+    for (auto object : artboard->objects())
+    {
+        if (object == nullptr || !object->is<rive::TransformComponent>())
+        {
+            continue;
+        }
+        transformCount++;
+        auto component = object->as<rive::TransformComponent>();
+        if (!component->constraints().empty() ||
+            (component->is<rive::Bone>() &&
+             !component->as<rive::Bone>()->peerConstraints().empty()))
+        {
+            constrainedCount++;
+        }
+    }
+    // The IK chain, its tip and the tip's descendants update on their own.
+    REQUIRE(constrainedCount != 0);
+    REQUIRE(pass.count() <= transformCount - constrainedCount);
+
+    // A rig is batched a level per bone in its longest chain.
+    auto bulletMan = ReadRiveFile("../../test/assets/bullet_man.riv");
+    auto rig = bulletMan->artboardDefault();
+    REQUIRE(rig->worldTransformPass().levelCount() > 2);
+}
+
+TEST_CASE("world transform pass only visits components with transform dirt", "[file]")
+{
+    auto file = ReadRiveFile("../../test/assets/bullet_man.riv");
+    auto artboard = file->artboardDefault();
+    auto& pass = artboard->worldTransformPass();
+    REQUIRE(pass.pendingCount() == pass.count());
+    artboard->advance(0.0f);
+    REQUIRE(pass.pendingCount() == 0);
+
+    rive::Shape* shape = nullptr;
+    rive::Bone* bone = nullptr;
+    for (auto object : artboard->objects())
+    {
+        if (object == nullptr)
+        {
+            continue;
+        }
+        if (shape == nullptr && object->is<rive::Shape>())
+        {
+            shape = object->as<rive::Shape>();
+        }
+        if (bone == nullptr && object->is<rive::Bone>())
+        {
+            bone = object->as<rive::Bone>();
+        }
+    }
+    REQUIRE(shape != nullptr);
+    REQUIRE(bone != nullptr);
+
+    // Opacity doesn't touch transforms, so the pass has nothing to do.
+    shape->opacity(shape->opacity() * 0.5f);
+    REQUIRE(pass.pendingCount() == 0);
+    artboard->advance(0.0f);
+
+    // Rotating a bone queues it and the batched transforms below it, once.
+    bone->rotation(bone->rotation() + 0.5f);
+    auto pending = pass.pendingCount();
+    REQUIRE(pending >= 1);
+    REQUIRE(pending <= pass.count());
+    bone->scaleX(bone->scaleX() * 2.0f);
+    REQUIRE(pass.pendingCount() == pending);
+    artboard->advance(0.0f);
+    REQUIRE(pass.pendingCount() == 0);
+}
+
+TEST_CASE("benchmark world transform pass", "[.benchmark]")
+{
+    for (auto asset : {"bullet_man.riv", "death_knight.riv"})
+    {
+        auto file = ReadRiveFile((std::string("../../test/assets/") + asset).c_str());
+        for (bool usePass : {true, false})
+        {
+            auto artboard = file->artboardDefault();
+            artboard->useWorldTransformPass(usePass);
+            auto animation = artboard->animationAt(0);
+            REQUIRE(animation != nullptr);
+            artboard->advance(0.0f);
+            BENCHMARK(std::string(usePass ? "batched " : "per component ") + asset)
+            {
+                animation->advanceAndApply(1.0f / 60.0f);
+                return artboard->objects().size();
+            };
+
+            // Frames that change no transforms shouldn't pay for the pass.
+            rive::Shape* shape = nullptr;
+            for (auto object : artboard->objects())
+            {
+                if (object != nullptr && object->is<rive::Shape>())
+                {
+                    shape = object->as<rive::Shape>();
+                    break;
+                }
+            }
+            REQUIRE(shape != nullptr);
+            float opacity = 1.0f;
+            BENCHMARK(std::string(usePass ? "batched " : "per component ") + asset +
+                      ", opacity only")
+            {
+                opacity = opacity == 1.0f ? 0.5f : 1.0f;
+                shape->opacity(opacity);
+                artboard->advance(0.0f);
+                return artboard->objects().size();
+            };
+        }
+    }
+}
@@ -58,7 +58,7 @@ void ViewerContent::DumpCounters(const char label[])
     printf("%s:", label);
     for (int i = 0; i <= rive::Counter::kLastType; ++i)
     {
-        printf(" [%s]:%d", gCounterNames[i], rive::Counter::counts[i]);
+        printf(" [%s]:%d", gCounterNames[i], rive::Counter::counts[i].load());
     }
     printf("\n");
 }